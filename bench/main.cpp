@@ -0,0 +1,366 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#include <math/math.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <atomic>
+#include <span>
+
+namespace
+{
+	/* Forces the compiler to materialize \a value, preventing dead-code elimination of benchmark kernels. */
+	template<typename T>
+	SEK_FORCEINLINE void do_not_optimize(const T &value) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static_cast<void>(*reinterpret_cast<const volatile char *>(&value));
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	/* Number of elements processed by a single invocation of every kernel. */
+	constexpr std::size_t batch_size = 1024;
+
+	struct bench_options
+	{
+		std::string_view filter;
+		std::string_view out_path;
+		std::string_view baseline_path;
+		double tolerance = 0.1;
+		double min_time = 0.05;
+		std::size_t repetitions = 5;
+	};
+	struct bench_result
+	{
+		std::string name;
+		std::string abi;
+		double ns_per_op;
+		double elements_per_second;
+	};
+
+	class bench_runner
+	{
+	public:
+		explicit bench_runner(const bench_options &opts) noexcept : m_opts(opts) {}
+
+		/** Times kernel \a f, which processes \a elements elements per invocation, and records the median time per element. */
+		template<typename F>
+		void run(std::string_view name, std::string_view abi, std::size_t elements, F &&f)
+		{
+			auto full_name = std::string{name};
+			full_name.append("/").append(abi);
+			if (!m_opts.filter.empty() && full_name.find(m_opts.filter) == std::string::npos) return;
+
+			using clock = std::chrono::steady_clock;
+			const auto time_n = [&](std::size_t n)
+			{
+				const auto start = clock::now();
+				for (std::size_t i = 0; i < n; ++i) f();
+				return std::chrono::duration<double>(clock::now() - start).count();
+			};
+
+			/* Warm up & find the iteration count that takes at least `min_time / repetitions` seconds. */
+			const auto target = m_opts.min_time / static_cast<double>(m_opts.repetitions);
+			std::size_t n = 1;
+			for (auto t = time_n(n); t < target && n < (std::size_t{1} << 30); t = time_n(n))
+				n = t <= 0.0 ? n * 16 : std::max(n * 2, static_cast<std::size_t>(static_cast<double>(n) * target * 1.2 / t));
+
+			std::vector<double> samples(m_opts.repetitions);
+			for (auto &s : samples) s = time_n(n) * 1e9 / static_cast<double>(n * elements);
+			std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+
+			const auto ns = samples[samples.size() / 2];
+			m_results.push_back({std::string{name}, std::string{abi}, ns, 1e9 / ns});
+			std::fprintf(stderr, "%-32s %-14s %10.3f ns/op %14.4g elem/s\n", m_results.back().name.c_str(), m_results.back().abi.c_str(), ns, 1e9 / ns);
+		}
+
+		[[nodiscard]] const std::vector<bench_result> &results() const noexcept { return m_results; }
+
+	private:
+		const bench_options &m_opts;
+		std::vector<bench_result> m_results;
+	};
+
+	/* Writes one benchmark per line, so that reports are easy to diff & parse by `read_report`. */
+	void write_report(std::ostream &os, const std::vector<bench_result> &results)
+	{
+		os << "{\n\t\"benchmarks\": [\n";
+		for (std::size_t i = 0; i < results.size(); ++i)
+		{
+			const auto &r = results[i];
+			os << "\t\t{\"name\": \"" << r.name << "\", \"abi\": \"" << r.abi << "\", \"ns_per_op\": " << r.ns_per_op
+			   << ", \"elements_per_second\": " << r.elements_per_second << '}' << (i + 1 < results.size() ? ",\n" : "\n");
+		}
+		os << "\t]\n}\n";
+	}
+	/* Reads entries of a report previously produced by `write_report`. */
+	[[nodiscard]] std::vector<bench_result> read_report(std::istream &is)
+	{
+		const auto str_field = [](std::string_view line, std::string_view key) -> std::string
+		{
+			const auto pos = line.find(key);
+			if (pos == std::string_view::npos) return {};
+			const auto first = pos + key.size(), last = line.find('"', first);
+			return std::string{line.substr(first, last - first)};
+		};
+
+		std::vector<bench_result> result;
+		for (std::string line; std::getline(is, line);)
+		{
+			auto entry = bench_result{str_field(line, "\"name\": \""), str_field(line, "\"abi\": \""), 0.0, 0.0};
+			if (const auto pos = line.find("\"ns_per_op\": "); pos != std::string::npos && !entry.name.empty())
+			{
+				entry.ns_per_op = std::strtod(line.c_str() + pos + 13, nullptr);
+				result.push_back(std::move(entry));
+			}
+		}
+		return result;
+	}
+	/* Compares \a results against \a baseline and returns `false` if any of the kernels is slower than it's baseline by more than \a tolerance. */
+	[[nodiscard]] bool check_baseline(const std::vector<bench_result> &results, const std::vector<bench_result> &baseline, double tolerance)
+	{
+		bool passed = true;
+		for (const auto &r : results)
+		{
+			const auto pred = [&](const bench_result &b) { return b.name == r.name && b.abi == r.abi; };
+			const auto base = std::find_if(baseline.begin(), baseline.end(), pred);
+			if (base == baseline.end() || base->ns_per_op <= 0.0) continue;
+
+			if (const auto ratio = r.ns_per_op / base->ns_per_op; ratio > 1.0 + tolerance)
+			{
+				std::fprintf(stderr, "regression: %s/%s %.3f ns/op (baseline %.3f ns/op, %+.1f%%)\n",
+				             r.name.c_str(), r.abi.c_str(), r.ns_per_op, base->ns_per_op, (ratio - 1.0) * 100.0);
+				passed = false;
+			}
+		}
+		return passed;
+	}
+
+	/* ABI policies every math kernel is instantiated with. */
+	struct packed_policy
+	{
+		constexpr static std::string_view name = "packed_buffer";
+		template<typename T, std::size_t N>
+		using abi = sek::math_abi::packed_buffer<N>;
+	};
+	struct compatible_policy
+	{
+		constexpr static std::string_view name = "compatible";
+		template<typename T, std::size_t N>
+		using abi = sek::math_abi::deduce_t<T, N, sek::math_abi::compatible<T>>;
+	};
+	struct fixed_size_policy
+	{
+		constexpr static std::string_view name = "fixed_size";
+		template<typename T, std::size_t N>
+		using abi = sek::math_abi::deduce_t<T, N, sek::math_abi::fixed_size<N>>;
+	};
+
+	template<typename T>
+	class random_source
+	{
+	public:
+		/** Returns a random value within [-1, 1). */
+		[[nodiscard]] T operator()() noexcept { return m_gen() * T{2} - T{1}; }
+
+		template<typename V>
+		[[nodiscard]] V vec() noexcept
+		{
+			V result;
+			for (std::size_t i = 0; i < result.size(); ++i) result[i] = operator()();
+			return result;
+		}
+
+	private:
+		sek::xoroshiro<T, 128> m_gen = sek::xoroshiro<T, 128>{0x5ec4e7};
+	};
+
+	template<typename P>
+	void bench_math(bench_runner &runner)
+	{
+		using T = float;
+		using vec3_t = sek::basic_vec<T, 3, typename P::template abi<T, 3>>;
+		using vec4_t = sek::basic_vec<T, 4, typename P::template abi<T, 4>>;
+		using mat4_t = sek::basic_mat<T, 4, 4, typename P::template abi<T, 4>>;
+		using quat_t = sek::basic_quat<T, typename P::template abi<T, 4>>;
+		using bbox_t = sek::basic_bounds<T, 3, typename P::template abi<T, 3>>;
+
+		random_source<T> rnd;
+		std::vector<vec3_t> a3(batch_size), b3(batch_size), out3(batch_size);
+		std::vector<vec4_t> a4(batch_size), b4(batch_size), c4(batch_size), out4(batch_size);
+		std::vector<mat4_t> m4(batch_size), out_m4(batch_size);
+		std::vector<quat_t> qa(batch_size), qb(batch_size), out_q(batch_size);
+		std::vector<bbox_t> boxes(batch_size), out_boxes(batch_size);
+		std::vector<T> f(batch_size);
+		for (std::size_t i = 0; i < batch_size; ++i)
+		{
+			a3[i] = rnd.template vec<vec3_t>();
+			b3[i] = rnd.template vec<vec3_t>();
+			a4[i] = rnd.template vec<vec4_t>();
+			b4[i] = rnd.template vec<vec4_t>();
+			c4[i] = rnd.template vec<vec4_t>();
+			f[i] = rnd() * T{0.5} + T{0.5};
+
+			/* Random affine transforms are well-conditioned enough for inversion. */
+			m4[i] = sek::rotate(mat4_t::identity(), rnd(), sek::normalize(rnd.template vec<vec3_t>()));
+			m4[i][3] = vec4_t{a3[i], T{1}};
+			qa[i] = sek::normalize(quat_t{rnd.template vec<vec4_t>()});
+			qb[i] = sek::normalize(quat_t{rnd.template vec<vec4_t>()});
+
+			const auto c = rnd.template vec<vec3_t>();
+			boxes[i] = bbox_t{c, c + sek::abs(rnd.template vec<vec3_t>())};
+		}
+		const auto &m = m4[0];
+
+		runner.run("vec4_arith", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out4[i] = (a4[i] + b4[i]) * c4[i] - a4[i] / (c4[i] + T{2});
+			do_not_optimize(out4.data());
+		});
+		runner.run("vec4_fmadd", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out4[i] = sek::fmadd(a4[i], b4[i], c4[i]);
+			do_not_optimize(out4.data());
+		});
+		runner.run("vec3_cross_dot", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out3[i] = sek::cross(a3[i], b3[i]) * sek::dot(a3[i], b3[i]);
+			do_not_optimize(out3.data());
+		});
+		runner.run("vec3_normalize", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out3[i] = sek::normalize(a3[i]);
+			do_not_optimize(out3.data());
+		});
+
+		runner.run("mat4_mul_vec4", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out4[i] = m * a4[i];
+			do_not_optimize(out4.data());
+		});
+		runner.run("mat4_mul_mat4", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_m4[i] = m4[i] * m;
+			do_not_optimize(out_m4.data());
+		});
+		runner.run("mat4_inverse", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_m4[i] = sek::inverse(m4[i]);
+			do_not_optimize(out_m4.data());
+		});
+		runner.run("mat4_look_at", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_m4[i] = mat4_t::look_at(a3[i], b3[i]);
+			do_not_optimize(out_m4.data());
+		});
+
+		runner.run("quat_slerp", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_q[i] = sek::slerp(qa[i], qb[i], f[i]);
+			do_not_optimize(out_q.data());
+		});
+		runner.run("quat_look_at", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_q[i] = quat_t::look_at(sek::normalize(a3[i]));
+			do_not_optimize(out_q.data());
+		});
+
+		runner.run("bbox_transform", P::name, batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i) out_boxes[i] = m * boxes[i];
+			do_not_optimize(out_boxes.data());
+		});
+		runner.run("bbox_transform_batch", P::name, batch_size, [&]()
+		{
+			sek::transform_bounds(m, std::span<const bbox_t>{boxes}, std::span{out_boxes});
+			do_not_optimize(out_boxes.data());
+		});
+	}
+
+	template<typename T, std::size_t Width>
+	void bench_xoroshiro(bench_runner &runner, std::string_view name)
+	{
+		auto gen = sek::xoroshiro<T, Width>{0x5ec4e7};
+		std::vector<T> out(batch_size);
+
+		runner.run(std::string{name} + "_next", "scalar", batch_size, [&]()
+		{
+			for (auto &x : out) x = gen();
+			do_not_optimize(out.data());
+		});
+		runner.run(std::string{name} + "_generate", "native", batch_size, [&]()
+		{
+			gen.generate(std::span{out});
+			do_not_optimize(out.data());
+		});
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	bench_options opts;
+	for (int i = 1; i < argc; ++i)
+	{
+		const auto arg = std::string_view{argv[i]};
+		const auto has_value = i + 1 < argc;
+		if (arg == "--filter" && has_value)
+			opts.filter = argv[++i];
+		else if (arg == "--out" && has_value)
+			opts.out_path = argv[++i];
+		else if (arg == "--baseline" && has_value)
+			opts.baseline_path = argv[++i];
+		else if (arg == "--tolerance" && has_value)
+			opts.tolerance = std::strtod(argv[++i], nullptr);
+		else if (arg == "--min-time" && has_value)
+			opts.min_time = std::strtod(argv[++i], nullptr);
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--filter <substring>] [--out <report.json>] [--baseline <report.json>] [--tolerance <ratio>] [--min-time <seconds>]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	bench_runner runner{opts};
+	bench_math<packed_policy>(runner);
+	bench_math<compatible_policy>(runner);
+	bench_math<fixed_size_policy>(runner);
+
+	bench_xoroshiro<std::uint64_t, 256>(runner, "xoroshiro256_u64");
+	bench_xoroshiro<std::uint64_t, 128>(runner, "xoroshiro128_u64");
+	bench_xoroshiro<double, 256>(runner, "xoroshiro256_f64");
+	bench_xoroshiro<double, 128>(runner, "xoroshiro128_f64");
+	bench_xoroshiro<std::uint32_t, 128>(runner, "xoroshiro128_u32");
+	bench_xoroshiro<float, 128>(runner, "xoroshiro128_f32");
+
+	if (opts.out_path.empty())
+		write_report(std::cout, runner.results());
+	else
+	{
+		std::ofstream os{std::string{opts.out_path}};
+		write_report(os, runner.results());
+	}
+
+	if (!opts.baseline_path.empty())
+	{
+		std::ifstream is{std::string{opts.baseline_path}};
+		if (!is.is_open())
+		{
+			std::fprintf(stderr, "failed to open baseline report %.*s\n", static_cast<int>(opts.baseline_path.size()), opts.baseline_path.data());
+			return 2;
+		}
+		if (!check_baseline(runner.results(), read_report(is), opts.tolerance)) return 1;
+	}
+	return 0;
+}
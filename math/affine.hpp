@@ -0,0 +1,189 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include "quaternion.hpp"
+
+namespace sek
+{
+	/** @brief Structure used to define an affine 3D transform.
+	 *
+	 * Affine transforms are stored as 3x4 matrices made of the 3x3 linear part and a translation column.
+	 * The implicit last row of an affine transform is always `[0 0 0 1]`, which allows for cheaper composition
+	 * and inversion than that of a generic 4x4 matrix.
+	 *
+	 * Size of the transform depends on the \a Abi tag. Vectorized ABIs may pad every column to 4 elements, in which case
+	 * the transform occupies 16 scalars (same as a 4x4 matrix). Use `packed_affine3` for a compact 12-scalar layout.
+	 *
+	 * @tparam T Value type stored by the transform.
+	 * @tparam Abi ABI tag used for the underlying storage of the transform.
+	 * @note The \a Abi tag size must be `3`. */
+	template<std::floating_point T, typename Abi>
+	class basic_affine3
+	{
+	public:
+		using col_type = basic_vec<T, 3, Abi>;
+		using value_type = typename col_type::value_type;
+		using linear_type = basic_mat<T, 3, 3, Abi>;
+		using matrix_type = basic_mat<T, 4, 3, Abi>;
+
+		/** Returns identity transform. */
+		[[nodiscard]] static basic_affine3 identity() noexcept { return basic_affine3{linear_type::identity()}; }
+
+		/** Creates a transform from translation vector \a v. */
+		template<typename A>
+		[[nodiscard]] static basic_affine3 from_translation(const basic_vec<T, 3, A> &v) noexcept { return {linear_type::identity(), v}; }
+		/** Creates a transform from scale vector \a v. */
+		template<typename A>
+		[[nodiscard]] static basic_affine3 from_scale(const basic_vec<T, 3, A> &v) noexcept
+		{
+			return basic_affine3{linear_type{col_type{v[0], 0, 0}, col_type{0, v[1], 0}, col_type{0, 0, v[2]}}};
+		}
+
+	public:
+		/** Initializes a null (zero) transform. */
+		constexpr basic_affine3() noexcept = default;
+
+		/** Initializes the transform from a linear part \a l and a translation vector \a t. */
+		template<typename A0, typename A1 = Abi>
+		basic_affine3(const basic_mat<T, 3, 3, A0> &l, const basic_vec<T, 3, A1> &t = {}) noexcept : m_matrix(l[0], l[1], l[2], t) {}
+		/** Initializes the transform from a quaternion rotation \a q and a translation vector \a t. */
+		template<typename A0, typename A1 = Abi>
+		basic_affine3(const basic_quat<T, A0> &q, const basic_vec<T, 3, A1> &t = {}) noexcept : basic_affine3(linear_type{q}, t) {}
+		/** Initializes the transform from a 3x4 matrix. */
+		template<typename A>
+		constexpr explicit basic_affine3(const basic_mat<T, 4, 3, A> &m) noexcept : m_matrix(m) {}
+		/** Initializes the transform from a 4x4 matrix.
+		 * @note The last row of \a m is expected to be `[0 0 0 1]` and is discarded. */
+		template<typename A>
+		explicit basic_affine3(const basic_mat<T, 4, 4, A> &m) noexcept : m_matrix(m[0].xyz(), m[1].xyz(), m[2].xyz(), m[3].xyz()) {}
+
+		/** Returns reference to the `i`th column of the transform.
+		 * @param i Index of the requested column. Columns `0` to `2` are the linear part, and column `3` is the translation.
+		 * @throw std::range_error In case \a i exceeds `3`. */
+		[[nodiscard]] col_type &at(std::size_t i) { return m_matrix.col(i); }
+		/** @copydoc at */
+		[[nodiscard]] const col_type &at(std::size_t i) const { return m_matrix.col(i); }
+
+		/** Returns reference to the `i`th column of the transform.
+		 * @param i Index of the requested column. Columns `0` to `2` are the linear part, and column `3` is the translation. */
+		[[nodiscard]] constexpr col_type &operator[](std::size_t i) noexcept { return m_matrix[i]; }
+		/** @copydoc operator[] */
+		[[nodiscard]] constexpr const col_type &operator[](std::size_t i) const noexcept { return m_matrix[i]; }
+
+		/** Returns reference to the translation column of the transform. */
+		[[nodiscard]] constexpr col_type &translation() noexcept { return m_matrix[3]; }
+		/** Returns copy of the translation column of the transform. */
+		[[nodiscard]] constexpr const col_type &translation() const noexcept { return m_matrix[3]; }
+		/** Returns the 3x3 linear part of the transform. */
+		[[nodiscard]] linear_type linear() const noexcept { return {m_matrix[0], m_matrix[1], m_matrix[2]}; }
+
+		/** Returns the underlying 3x4 matrix of the transform. */
+		[[nodiscard]] constexpr const matrix_type &matrix() const noexcept { return m_matrix; }
+		/** Converts the transform to a 4x4 matrix with the last row set to `[0 0 0 1]`. */
+		template<typename A>
+		[[nodiscard]] explicit operator basic_mat<T, 4, 4, A>() const noexcept
+		{
+			using vec4_t = basic_vec<T, 4, A>;
+			return {vec4_t{m_matrix[0], 0}, vec4_t{m_matrix[1], 0}, vec4_t{m_matrix[2], 0}, vec4_t{m_matrix[3], 1}};
+		}
+
+	private:
+		matrix_type m_matrix;
+	};
+
+#pragma region "basic_affine3 aliases"
+	/** Alias for affine transform that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<3>>
+	using affine3 = basic_affine3<T, math_abi::deduce_t<T, 3, Abi>>;
+	/** Alias for affine transform that uses implementation-defined compatible ABI. */
+	template<typename T>
+	using compat_affine3 = basic_affine3<T, math_abi::deduce_t<T, 3, math_abi::compatible<T>>>;
+	/** Alias for affine transform that uses packed (non-vectorized) ABI.
+	 * Packed transforms always occupy exactly 12 scalars. */
+	template<typename T>
+	using packed_affine3 = basic_affine3<T, math_abi::packed_buffer<3>>;
+#pragma endregion
+
+#pragma region "basic_affine3 operators"
+	/** Composes affine transforms \a a and \a b. Equivalent to multiplication of the corresponding 4x4 matrices.
+	 * @note Composition requires 36 multiplications instead of 64 required for 4x4 matrices. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_affine3<T, Abi> operator*(const basic_affine3<T, Abi> &a, const basic_affine3<T, Abi> &b) noexcept
+	{
+		using col_t = typename basic_affine3<T, Abi>::col_type;
+
+		basic_affine3<T, Abi> result;
+		for (std::size_t i = 0; i < 3; ++i)
+			result[i] = fmadd(a[2], col_t{b[i][2]}, fmadd(a[1], col_t{b[i][1]}, a[0] * col_t{b[i][0]}));
+		result[3] = fmadd(a[2], col_t{b[3][2]}, fmadd(a[1], col_t{b[3][1]}, fmadd(a[0], col_t{b[3][0]}, a[3])));
+		return result;
+	}
+	template<typename T, typename Abi>
+	inline basic_affine3<T, Abi> &operator*=(basic_affine3<T, Abi> &a, const basic_affine3<T, Abi> &b) noexcept { return a = a * b; }
+
+	template<typename T, typename Abi>
+	[[nodiscard]] inline bool operator==(const basic_affine3<T, Abi> &a, const basic_affine3<T, Abi> &b) noexcept { return a.matrix() == b.matrix(); }
+	template<typename T, typename Abi>
+	[[nodiscard]] inline bool operator!=(const basic_affine3<T, Abi> &a, const basic_affine3<T, Abi> &b) noexcept { return !(a == b); }
+#pragma endregion
+
+#pragma region "basic_affine3 functions"
+	/** Transforms point \a v by affine transform \a a. Equivalent to `(mat4x4{a} * vec4{v, 1}).xyz()`. */
+	template<typename T, typename Abi, typename A>
+	[[nodiscard]] inline basic_vec<T, 3, A> transform_point(const basic_affine3<T, Abi> &a, const basic_vec<T, 3, A> &v) noexcept
+	{
+		using col_t = typename basic_affine3<T, Abi>::col_type;
+		return basic_vec<T, 3, A>{fmadd(a[2], col_t{v[2]}, fmadd(a[1], col_t{v[1]}, fmadd(a[0], col_t{v[0]}, a[3])))};
+	}
+	/** Transforms direction \a v by affine transform \a a. Equivalent to `(mat4x4{a} * vec4{v, 0}).xyz()`. */
+	template<typename T, typename Abi, typename A>
+	[[nodiscard]] inline basic_vec<T, 3, A> transform_direction(const basic_affine3<T, Abi> &a, const basic_vec<T, 3, A> &v) noexcept
+	{
+		using col_t = typename basic_affine3<T, Abi>::col_type;
+		return basic_vec<T, 3, A>{fmadd(a[2], col_t{v[2]}, fmadd(a[1], col_t{v[1]}, a[0] * col_t{v[0]}))};
+	}
+
+	/** Transforms 3D points from \a in by affine transform \a a and writes them to \a out.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename Abi, typename AI, typename AO>
+	inline void transform_points(const basic_affine3<T, Abi> &a, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, true, false>(a.matrix(), in, out);
+	}
+	/** Transforms 3D directions from \a in by affine transform \a a and writes them to \a out.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename Abi, typename AI, typename AO>
+	inline void transform_directions(const basic_affine3<T, Abi> &a, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, false, false>(a.matrix(), in, out);
+	}
+
+	/** Calculates the inverse of a general affine transform \a x.
+	 * @note Inverse of the linear part is calculated via cross products of it's columns. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_affine3<T, Abi> inverse(const basic_affine3<T, Abi> &x) noexcept
+	{
+		using col_t = typename basic_affine3<T, Abi>::col_type;
+
+		/* Rows of the inverse linear part are cross products of the columns divided by the determinant. */
+		const auto r0 = cross(x[1], x[2]);
+		const auto r1 = cross(x[2], x[0]);
+		const auto r2 = cross(x[0], x[1]);
+		const auto k = col_t{T{1} / dot(x[0], r0)};
+		const auto l = transpose(basic_mat<T, 3, 3, Abi>{r0 * k, r1 * k, r2 * k});
+		return {l, -transform_direction(basic_affine3<T, Abi>{l}, x.translation())};
+	}
+	/** Calculates the inverse of a rigid (rotation and translation only) affine transform \a x.
+	 * @note Result is undefined if the linear part of \a x is not orthonormal. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_affine3<T, Abi> inverse_rigid(const basic_affine3<T, Abi> &x) noexcept
+	{
+		const auto &t = x.translation();
+		const auto l = transpose(x.linear());
+		return {l, typename basic_affine3<T, Abi>::col_type{-dot(x[0], t), -dot(x[1], t), -dot(x[2], t)}};
+	}
+#pragma endregion
+}
@@ -113,7 +113,7 @@ namespace sek
 #pragma region "projection functions"
 	template<typename T, std::size_t NCols, std::size_t NRows, typename Abi>
 	template<typename A>
-	basic_mat<T, NCols, NRows, Abi> basic_mat<T, NCols, NRows, Abi>::rect_projection(const basic_bounds<T, 2, A> &sr, const basic_bounds<T, 2, A> &vp) noexcept requires (NCols == NRows && NCols == 4)
+	constexpr basic_mat<T, NCols, NRows, Abi> basic_mat<T, NCols, NRows, Abi>::rect_projection(const basic_bounds<T, 2, A> &sr, const basic_bounds<T, 2, A> &vp) noexcept requires (NCols == NRows && NCols == 4)
 	{
 		const auto sr_size = sr.size();
 		SEK_ASSERT((sr_size > vec2<T, A>{0}));
@@ -157,33 +157,37 @@ namespace sek
 	template<typename T, std::size_t N, typename Abi>
 	[[nodiscard]] inline basic_bounds<T, N, Abi> operator-(const basic_bounds<T, N, Abi> &x) noexcept { return {-x.min(), -x.max()}; }
 
+	/** Transforms bounding box \a b by affine matrix \a a. The result is the smallest axis-aligned box containing the transformed box \a b.
+	 * @note Transformation is done using the method of J. Arvo ("Transforming Axis-Aligned Bounding Boxes", Graphics Gems, 1990),
+	 * where the center is transformed by \a a and the extent by the element-wise absolute value of the linear part of \a a.
+	 * @note The last row of \a a is ignored, projective matrices are not supported. */
 	template<typename T, typename AM, typename AB = math_abi::deduce_t<T, 3, AM>>
 	[[nodiscard]] inline basic_bounds<T, 3, AB> operator*(const basic_mat<T, 4, 4, AM> &a, const basic_bounds<T, 3, AB> &b) noexcept
 	{
-		typename basic_bounds<T, 3, AB>::vector_type min, max;
-		min = max = a[3].xyz();
+		const auto c = b.center(), e = b.size() / static_cast<T>(2);
 
+		typename basic_bounds<T, 3, AB>::vector_type rc = a[3].xyz(), re = {};
 		for (std::size_t i = 0; i < 3; ++i)
 		{
-			const auto va = a[i].xyz() * b.min();
-			const auto vb = a[i].xyz() * b.max();
-			min += sek::min(va, va);
-			max += sek::max(vb, vb);
+			rc = fmadd(a[i].xyz(), {c[i]}, rc);
+			re = fmadd(abs(a[i].xyz()), {e[i]}, re);
 		}
-		return {min, max};
+		return {rc - re, rc + re};
 	}
+	/** Transforms bounding box \a b by linear matrix \a a. The result is the smallest axis-aligned box containing the transformed box \a b.
+	 * @note Transformation is done using the method of J. Arvo ("Transforming Axis-Aligned Bounding Boxes", Graphics Gems, 1990). */
 	template<typename T, typename A>
 	[[nodiscard]] inline basic_bounds<T, 3, A> operator*(const basic_mat<T, 3, 3, A> &a, const basic_bounds<T, 3, A> &b) noexcept
 	{
-		typename basic_bounds<T, 3, A>::vector_type min = {}, max = {};
+		const auto c = b.center(), e = b.size() / static_cast<T>(2);
+
+		typename basic_bounds<T, 3, A>::vector_type rc = {}, re = {};
 		for (std::size_t i = 0; i < 3; ++i)
 		{
-			const auto va = a[i].xyz() * b.min();
-			const auto vb = a[i].xyz() * b.max();
-			min += sek::min(va, va);
-			max += sek::max(vb, vb);
+			rc = fmadd(a[i], {c[i]}, rc);
+			re = fmadd(abs(a[i]), {e[i]}, re);
 		}
-		return {min, max};
+		return {rc - re, rc + re};
 	}
 
 	template<typename T, std::size_t N, typename Abi>
@@ -192,6 +196,125 @@ namespace sek
 	[[nodiscard]] inline bool operator!=(const basic_bounds<T, N, Abi> &a, const basic_bounds<T, N, Abi> &b) noexcept { return a.min() != a.max() & b.min() != b.max(); }
 #pragma endregion
 
+	namespace detail
+	{
+		/* Transforms bounding boxes from `in` in blocks of `native_vec<T>::size()` boxes using Arvo's method. Boxes are
+		 * de-interleaved into center & extent lanes. If `PerBox` is `false`, `m` contains a single matrix which is broadcast
+		 * once for the entire batch, otherwise matrices of every block are de-interleaved into lanes alongside the boxes. */
+		template<bool PerBox, typename T, std::size_t NC, typename AM, typename AB>
+		inline void transform_bounds_batch(std::span<const basic_mat<T, NC, NC, AM>> m, std::span<const basic_bounds<T, 3, AB>> in, std::span<basic_bounds<T, 3, AB>> out) noexcept
+		{
+			static_assert(NC == 3 || NC == 4);
+
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+			constexpr auto translate = NC == 4;
+
+			SEK_ASSERT(out.size() >= in.size());
+			SEK_ASSERT(PerBox ? m.size() >= in.size() : m.size() == 1);
+
+			lane_t bm[NC][3], ba[3][3];
+			if constexpr (!PerBox)
+				for (std::size_t c = 0; c < NC; ++c)
+					for (std::size_t r = 0; r < 3; ++r)
+					{
+						bm[c][r] = lane_t{m[0][c][r]};
+						if (c < 3) ba[c][r] = abs(bm[c][r]);
+					}
+
+			alignas(align) T buff[6][w];
+			alignas(align) T mbuff[PerBox ? NC * 3 : 1][w];
+			for (std::size_t i = 0; i < in.size(); i += w)
+			{
+				const auto n = std::min(w, in.size() - i);
+				if (n < w) [[unlikely]]
+				{
+					std::fill_n(&buff[0][0], 6 * w, T{0});
+					if constexpr (PerBox) std::fill_n(&mbuff[0][0], NC * 3 * w, T{0});
+				}
+
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					const auto c = in[i + k].center(), e = in[i + k].size() / static_cast<T>(2);
+					for (std::size_t r = 0; r < 3; ++r)
+					{
+						buff[r][k] = c[r];
+						buff[r + 3][k] = e[r];
+					}
+					if constexpr (PerBox)
+						for (std::size_t c = 0; c < NC; ++c)
+							for (std::size_t r = 0; r < 3; ++r) mbuff[c * 3 + r][k] = m[i + k][c][r];
+				}
+				if constexpr (PerBox)
+					for (std::size_t c = 0; c < NC; ++c)
+						for (std::size_t r = 0; r < 3; ++r)
+						{
+							to_simd(bm[c][r]).copy_from(mbuff[c * 3 + r], dpm::vector_aligned);
+							if (c < 3) ba[c][r] = abs(bm[c][r]);
+						}
+
+				lane_t x[3], e[3];
+				for (std::size_t r = 0; r < 3; ++r)
+				{
+					to_simd(x[r]).copy_from(buff[r], dpm::vector_aligned);
+					to_simd(e[r]).copy_from(buff[r + 3], dpm::vector_aligned);
+				}
+				for (std::size_t r = 0; r < 3; ++r)
+				{
+					auto rc = translate ? bm[NC - 1][r] : x[0] * bm[0][r];
+					for (std::size_t c = translate ? 0 : 1; c < 3; ++c) rc = fmadd(x[c], bm[c][r], rc);
+					const auto re = fmadd(e[2], ba[2][r], fmadd(e[1], ba[1][r], e[0] * ba[0][r]));
+
+					to_simd(rc - re).copy_to(buff[r], dpm::vector_aligned);
+					to_simd(rc + re).copy_to(buff[r + 3], dpm::vector_aligned);
+				}
+
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					typename basic_bounds<T, 3, AB>::vector_type min, max;
+					for (std::size_t r = 0; r < 3; ++r)
+					{
+						min[r] = buff[r][k];
+						max[r] = buff[r + 3][k];
+					}
+					out[i + k] = {min, max};
+				}
+			}
+		}
+	}
+
+#pragma region "batched transform functions"
+	/** Transforms bounding boxes from \a in by affine matrix \a m and writes them to \a out. Equivalent to `m * in[i]` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AB>
+	inline void transform_bounds(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_bounds<T, 3, AB>> in, std::span<basic_bounds<T, 3, AB>> out) noexcept
+	{
+		detail::transform_bounds_batch<false>(std::span{&m, 1}, in, out);
+	}
+	/** Transforms bounding boxes from \a in by linear matrix \a m and writes them to \a out. Equivalent to `m * in[i]` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AB>
+	inline void transform_bounds(const basic_mat<T, 3, 3, AM> &m, std::span<const basic_bounds<T, 3, AB>> in, std::span<basic_bounds<T, 3, AB>> out) noexcept
+	{
+		detail::transform_bounds_batch<false>(std::span{&m, 1}, in, out);
+	}
+	/** Transforms bounding boxes from \a in by affine matrices from \a m and writes them to \a out. Equivalent to `m[i] * in[i]` for every element `i`.
+	 * @note \a m must be at least `in.size()` elements long. \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AB>
+	inline void transform_bounds(std::span<const basic_mat<T, 4, 4, AM>> m, std::span<const basic_bounds<T, 3, AB>> in, std::span<basic_bounds<T, 3, AB>> out) noexcept
+	{
+		detail::transform_bounds_batch<true>(m, in, out);
+	}
+	/** Transforms bounding boxes from \a in by linear matrices from \a m and writes them to \a out. Equivalent to `m[i] * in[i]` for every element `i`.
+	 * @note \a m must be at least `in.size()` elements long. \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AB>
+	inline void transform_bounds(std::span<const basic_mat<T, 3, 3, AM>> m, std::span<const basic_bounds<T, 3, AB>> in, std::span<basic_bounds<T, 3, AB>> out) noexcept
+	{
+		detail::transform_bounds_batch<true>(m, in, out);
+	}
+#pragma endregion
+
 #pragma region "comparison functions"
 	/** Determines if elements of bounding volume \a a are within relative epsilon \a e_rel or absolute epsilon \a e_abs of bounding volume \a b.
 	 * @note If any of the elements of \a a or \a b are NaN, floating-point exceptions may be raised. */
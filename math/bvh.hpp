@@ -0,0 +1,584 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <numeric>
+#include <future>
+#include <thread>
+#include <utility>
+#include <memory>
+#include <vector>
+#include <span>
+
+#include "ray.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		template<typename T, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE basic_bounds<T, N, A> bounds_union(const basic_bounds<T, N, A> &a, const basic_bounds<T, N, A> &b) noexcept
+		{
+			return {sek::min(a.min(), b.min()), sek::max(a.max(), b.max())};
+		}
+		template<typename T, typename A>
+		[[nodiscard]] SEK_FORCEINLINE T bounds_area(const basic_bounds<T, 3, A> &x) noexcept
+		{
+			const auto d = x.size();
+			return (d[0] * d[1] + d[1] * d[2] + d[2] * d[0]) * T{2};
+		}
+		template<typename T, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE basic_bounds<T, N, A> bounds_empty() noexcept
+		{
+			return {basic_vec<T, N, A>{std::numeric_limits<T>::max()}, basic_vec<T, N, A>{std::numeric_limits<T>::lowest()}};
+		}
+
+		/* Traversal stack that keeps the first `Local` entries on the stack and spills to the heap only for degenerate trees. */
+		template<typename E, std::size_t Local = 64>
+		class bvh_stack
+		{
+		public:
+			[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+			void push(const E &e)
+			{
+				if (m_size < Local) [[likely]]
+					m_local[m_size] = e;
+				else
+					m_heap.push_back(e);
+				++m_size;
+			}
+			[[nodiscard]] E pop() noexcept
+			{
+				if (--m_size < Local) [[likely]]
+					return m_local[m_size];
+
+				const auto e = m_heap.back();
+				m_heap.pop_back();
+				return e;
+			}
+
+		private:
+			E m_local[Local];
+			std::vector<E> m_heap;
+			std::size_t m_size = 0;
+		};
+	}
+
+	/** @brief Bounding volume hierarchy over a set of 3D axis-aligned bounding boxes.
+	 *
+	 * The hierarchy is built top-down using the binned surface area heuristic (SAH), where large subtrees are built
+	 * in parallel. The resulting binary tree is collapsed into 4-wide nodes, where bounding boxes of all 4 children of
+	 * a node are stored in structure-of-arrays layout and are tested against a query using a single set of 4-wide vector operations.
+	 *
+	 * Every primitive of the hierarchy is identified by a user index, which is passed to query callbacks.
+	 *
+	 * @tparam T Value type of the bounding boxes.
+	 * @tparam Abi ABI tag of the bounding boxes. */
+	template<std::floating_point T, typename Abi = math_abi::deduce_t<T, 3, math_abi::fixed_size<3>>>
+	class basic_bvh
+	{
+	public:
+		using value_type = T;
+		using bounds_type = basic_bounds<T, 3, Abi>;
+		using vector_type = basic_vec<T, 3, Abi>;
+		using lane_type = vec4<T>;
+
+		/** Result of a nearest-hit query. */
+		struct hit_result
+		{
+			/** User index of the closest primitive. */
+			std::uint32_t index;
+			/** Distance along the ray to the closest primitive. */
+			T distance;
+		};
+
+		/** Width of the hierarchy nodes. */
+		constexpr static std::size_t node_width = 4;
+		/** Number of bins used by the SAH build. */
+		constexpr static std::size_t sah_bins = 16;
+		/** Maximum number of primitives in a leaf. */
+		constexpr static std::size_t max_leaf_size = 8;
+		/** Minimum number of primitives of a subtree to be built in parallel.
+		 * @note Parallel subtrees are only spawned for the top `log2(hardware_concurrency)` levels of the hierarchy. */
+		constexpr static std::size_t parallel_threshold = 4096;
+
+	private:
+		constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+		/* Flattened 4-wide node. Empty child slots have `child == npos`. Leaf slots have non-zero
+		 * `count` and reference `count` primitives starting at `child`, otherwise `child` is a node index. */
+		struct node_type
+		{
+			lane_type min[3];
+			lane_type max[3];
+			std::uint32_t child[node_width];
+			std::uint32_t count[node_width];
+		};
+
+		/* Binary tree produced by the SAH build, later collapsed into `node_type`. */
+		struct build_node
+		{
+			bounds_type bounds;
+			std::unique_ptr<build_node> left;
+			std::unique_ptr<build_node> right;
+			std::uint32_t first = 0;
+			std::uint32_t count = 0;
+		};
+		struct build_context
+		{
+			std::span<const bounds_type> bounds;
+			std::vector<vector_type> centers;
+			std::vector<std::uint32_t> refs;
+		};
+
+	public:
+		/** Initializes an empty hierarchy. */
+		basic_bvh() noexcept = default;
+
+		/** Builds the hierarchy over bounding boxes \a bounds. User index of every primitive is it's position within \a bounds. */
+		explicit basic_bvh(std::span<const bounds_type> bounds) { build(bounds); }
+		/** Builds the hierarchy over bounding boxes \a bounds with user indices \a indices.
+		 * @note Size of \a indices must match the size of \a bounds. */
+		basic_bvh(std::span<const bounds_type> bounds, std::span<const std::uint32_t> indices) { build(bounds, indices); }
+
+		/** Returns the number of primitives in the hierarchy. */
+		[[nodiscard]] std::size_t size() const noexcept { return m_index.size(); }
+		/** Checks if the hierarchy is empty. */
+		[[nodiscard]] bool empty() const noexcept { return m_index.empty(); }
+		/** Returns the number of nodes of the hierarchy. */
+		[[nodiscard]] std::size_t node_count() const noexcept { return m_nodes.size(); }
+		/** Returns the bounding box of all primitives of the hierarchy. */
+		[[nodiscard]] bounds_type bounds() const noexcept
+		{
+			auto result = detail::bounds_empty<T, 3, Abi>();
+			if (!m_nodes.empty()) [[likely]]
+				for (std::size_t i = 0; i < node_width; ++i)
+					if (m_nodes[0].child[i] != npos) result = detail::bounds_union(result, child_bounds(m_nodes[0], i));
+			return result;
+		}
+
+		/** Rebuilds the hierarchy over bounding boxes \a bounds. User index of every primitive is it's position within \a bounds. */
+		void build(std::span<const bounds_type> bounds)
+		{
+			std::vector<std::uint32_t> indices(bounds.size());
+			std::iota(indices.begin(), indices.end(), std::uint32_t{0});
+			build(bounds, indices);
+		}
+		/** Rebuilds the hierarchy over bounding boxes \a bounds with user indices \a indices.
+		 * @note Size of \a indices must match the size of \a bounds. */
+		void build(std::span<const bounds_type> bounds, std::span<const std::uint32_t> indices)
+		{
+			SEK_ASSERT(bounds.size() == indices.size());
+			SEK_ASSERT(bounds.size() < npos);
+
+			m_nodes.clear();
+			m_bounds.clear();
+			m_index.clear();
+			m_refs.clear();
+			if (bounds.empty()) return;
+
+			build_context ctx = {bounds, std::vector<vector_type>(bounds.size()), std::vector<std::uint32_t>(bounds.size())};
+			for (std::size_t i = 0; i < bounds.size(); ++i) ctx.centers[i] = bounds[i].center();
+			std::iota(ctx.refs.begin(), ctx.refs.end(), std::uint32_t{0});
+
+			const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+			const auto spawn_depth = static_cast<std::size_t>(std::bit_width(max_threads - 1));
+			const auto root = build_range(ctx, 0, static_cast<std::uint32_t>(bounds.size()), spawn_depth);
+
+			/* Primitives are stored in the leaf order, so that every leaf references a contiguous range. */
+			m_refs = std::move(ctx.refs);
+			m_bounds.resize(m_refs.size());
+			m_index.resize(m_refs.size());
+			for (std::size_t i = 0; i < m_refs.size(); ++i)
+			{
+				m_bounds[i] = bounds[m_refs[i]];
+				m_index[i] = indices[m_refs[i]];
+			}
+
+			if (root->left)
+				flatten(*root);
+			else
+			{
+				/* Single-leaf tree still requires a root node. */
+				auto &node = m_nodes.emplace_back(empty_node());
+				set_child(node, 0, root->bounds, root->first, root->count);
+			}
+		}
+
+		/** Updates bounding boxes of the hierarchy without changing it's topology.
+		 * @param bounds New bounding boxes of the primitives, in the same order as passed to `build`.
+		 * @note Query performance degrades as the primitives move away from their original positions, in which case the hierarchy should be rebuilt. */
+		void refit(std::span<const bounds_type> bounds) noexcept
+		{
+			SEK_ASSERT(bounds.size() == m_refs.size());
+			for (std::size_t i = 0; i < m_refs.size(); ++i) m_bounds[i] = bounds[m_refs[i]];
+
+			/* Nodes are stored in pre-order, so children are always refitted before their parents. */
+			for (auto i = m_nodes.size(); i-- > 0;)
+			{
+				auto &node = m_nodes[i];
+				for (std::size_t j = 0; j < node_width; ++j)
+				{
+					if (node.child[j] == npos) continue;
+
+					auto b = detail::bounds_empty<T, 3, Abi>();
+					if (node.count[j] != 0)
+						for (std::size_t k = 0; k < node.count[j]; ++k) b = detail::bounds_union(b, m_bounds[node.child[j] + k]);
+					else
+					{
+						const auto &c = m_nodes[node.child[j]];
+						for (std::size_t k = 0; k < node_width; ++k)
+							if (c.child[k] != npos) b = detail::bounds_union(b, child_bounds(c, k));
+					}
+					set_child(node, j, b, node.child[j], node.count[j]);
+				}
+			}
+		}
+
+		/** Invokes \a f with the user index of every primitive whose bounding box overlaps bounding box \a b. */
+		template<typename F>
+		void query_overlap(const bounds_type &b, F &&f) const
+		{
+			const lane_type bmin[3] = {lane_type{b.min()[0]}, lane_type{b.min()[1]}, lane_type{b.min()[2]}};
+			const lane_type bmax[3] = {lane_type{b.max()[0]}, lane_type{b.max()[1]}, lane_type{b.max()[2]}};
+			traverse([&](const node_type &n)
+			         {
+				         return (n.min[0] <= bmax[0]) && (n.max[0] >= bmin[0]) &&
+				                (n.min[1] <= bmax[1]) && (n.max[1] >= bmin[1]) &&
+				                (n.min[2] <= bmax[2]) && (n.max[2] >= bmin[2]);
+			         }, [&](std::uint32_t i)
+			         {
+				         const auto &p = m_bounds[i];
+				         if (all_of(p.min() <= b.max()) && all_of(p.max() >= b.min())) f(m_index[i]);
+			         });
+		}
+		/** Invokes \a f with the user index of every primitive whose bounding box contains point \a p. */
+		template<typename F>
+		void query_point(const vector_type &p, F &&f) const
+		{
+			const lane_type pl[3] = {lane_type{p[0]}, lane_type{p[1]}, lane_type{p[2]}};
+			traverse([&](const node_type &n)
+			         {
+				         return (n.min[0] <= pl[0]) && (n.max[0] >= pl[0]) &&
+				                (n.min[1] <= pl[1]) && (n.max[1] >= pl[1]) &&
+				                (n.min[2] <= pl[2]) && (n.max[2] >= pl[2]);
+			         }, [&](std::uint32_t i)
+			         {
+				         const auto &b = m_bounds[i];
+				         if (all_of(b.min() <= p) && all_of(b.max() >= p)) f(m_index[i]);
+			         });
+		}
+
+		/** Finds the closest primitive intersected by a ray, using bounding boxes of the primitives as their geometry.
+		 * @param origin Origin of the ray.
+		 * @param dir Direction of the ray. Does not need to be normalized, distances are expressed in units of \a dir.
+		 * @param tmax Maximum distance along the ray.
+		 * @return Closest hit, or an empty optional if the ray does not hit any primitive within \a tmax. */
+		[[nodiscard]] std::optional<hit_result> nearest_hit(const vector_type &origin, const vector_type &dir, T tmax = std::numeric_limits<T>::infinity()) const
+		{
+			return nearest_hit(basic_ray<T, 3, Abi>{origin, dir}, tmax);
+		}
+		/** Finds the closest primitive intersected by ray \a r, using bounding boxes of the primitives as their geometry.
+		 * @param r Ray to intersect.
+		 * @param tmax Maximum distance along the ray.
+		 * @return Closest hit, or an empty optional if the ray does not hit any primitive within \a tmax. */
+		[[nodiscard]] std::optional<hit_result> nearest_hit(const basic_ray<T, 3, Abi> &r, T tmax = std::numeric_limits<T>::infinity()) const
+		{
+			return nearest_hit(r.origin(), r.direction(), tmax, [&](std::uint32_t, const bounds_type &b, T t) -> std::optional<T>
+			{
+				if (const auto i = intersect(r, b, T{0}, t); i.hit()) return i.tnear;
+				return std::nullopt;
+			});
+		}
+		/** Finds the closest primitive intersected by a ray, using \a f to intersect the ray with primitives.
+		 * @param origin Origin of the ray.
+		 * @param dir Direction of the ray.
+		 * @param tmax Maximum distance along the ray.
+		 * @param f Invocable with signature `std::optional<T>(std::uint32_t index, const bounds_type &bounds, T tmax)`,
+		 * returning distance to the intersection with primitive of user index `index` closer than `tmax`, if any.
+		 * @return Closest hit, or an empty optional if the ray does not hit any primitive within \a tmax.
+		 * @note Nodes are visited in front-to-back order and subtrees beyond the closest hit are skipped. */
+		template<typename F>
+		[[nodiscard]] std::optional<hit_result> nearest_hit(const vector_type &origin, const vector_type &dir, T tmax, F &&f) const
+		{
+			struct entry
+			{
+				std::uint32_t node;
+				T tnear;
+			};
+
+			if (m_nodes.empty()) [[unlikely]] return std::nullopt;
+
+			const auto inv = vector_type{T{1}} / dir;
+			const lane_type ol[3] = {lane_type{origin[0]}, lane_type{origin[1]}, lane_type{origin[2]}};
+			const lane_type il[3] = {lane_type{inv[0]}, lane_type{inv[1]}, lane_type{inv[2]}};
+
+			std::optional<hit_result> result;
+			detail::bvh_stack<entry> stack;
+			stack.push({0, T{0}});
+			while (!stack.empty())
+			{
+				const auto [idx, tnear] = stack.pop();
+				if (tnear > tmax) continue;
+
+				const auto &n = m_nodes[idx];
+				auto tn = lane_type{T{0}}, tf = lane_type{tmax};
+				for (std::size_t a = 0; a < 3; ++a)
+				{
+					const auto t0 = (n.min[a] - ol[a]) * il[a];
+					const auto t1 = (n.max[a] - ol[a]) * il[a];
+					tn = sek::max(tn, sek::min(t0, t1));
+					tf = sek::min(tf, sek::max(t0, t1));
+				}
+				const auto hit = tn <= tf;
+
+				/* Internal children are pushed far-to-near, so that the nearest child is visited first. */
+				entry children[node_width];
+				std::size_t n_children = 0;
+				for (std::size_t i = 0; i < node_width; ++i)
+				{
+					if (n.child[i] == npos || !hit[i]) continue;
+					if (n.count[i] == 0)
+					{
+						children[n_children++] = {n.child[i], tn[i]};
+						continue;
+					}
+					for (auto j = n.child[i]; j < n.child[i] + n.count[i]; ++j)
+						if (const auto t = f(m_index[j], std::as_const(m_bounds[j]), tmax); t.has_value() && *t <= tmax)
+						{
+							tmax = *t;
+							result = hit_result{m_index[j], *t};
+						}
+				}
+				for (std::size_t i = 1; i < n_children; ++i)
+				{
+					const auto tmp = children[i];
+					auto j = i;
+					for (; j != 0 && children[j - 1].tnear < tmp.tnear; --j) children[j] = children[j - 1];
+					children[j] = tmp;
+				}
+				for (std::size_t i = 0; i < n_children; ++i) stack.push(children[i]);
+			}
+			return result;
+		}
+
+	private:
+		[[nodiscard]] static node_type empty_node() noexcept
+		{
+			node_type result;
+			for (std::size_t a = 0; a < 3; ++a)
+			{
+				result.min[a] = lane_type{std::numeric_limits<T>::max()};
+				result.max[a] = lane_type{std::numeric_limits<T>::lowest()};
+			}
+			std::fill_n(result.child, node_width, npos);
+			std::fill_n(result.count, node_width, 0);
+			return result;
+		}
+		[[nodiscard]] static bounds_type child_bounds(const node_type &n, std::size_t i) noexcept
+		{
+			return {vector_type{n.min[0][i], n.min[1][i], n.min[2][i]}, vector_type{n.max[0][i], n.max[1][i], n.max[2][i]}};
+		}
+		static void set_child(node_type &n, std::size_t i, const bounds_type &b, std::uint32_t child, std::uint32_t count) noexcept
+		{
+			for (std::size_t a = 0; a < 3; ++a)
+			{
+				n.min[a][i] = b.min()[a];
+				n.max[a][i] = b.max()[a];
+			}
+			n.child[i] = child;
+			n.count[i] = count;
+		}
+
+		template<typename NF, typename PF>
+		void traverse(NF &&test_node, PF &&test_prim) const
+		{
+			if (m_nodes.empty()) [[unlikely]] return;
+
+			detail::bvh_stack<std::uint32_t> stack;
+			stack.push(0);
+			while (!stack.empty())
+			{
+				const auto &n = m_nodes[stack.pop()];
+				const auto hit = test_node(n);
+				for (std::size_t i = 0; i < node_width; ++i)
+				{
+					if (n.child[i] == npos || !hit[i]) continue;
+					if (n.count[i] == 0)
+						stack.push(n.child[i]);
+					else
+						for (auto j = n.child[i]; j < n.child[i] + n.count[i]; ++j) test_prim(j);
+				}
+			}
+		}
+
+		[[nodiscard]] static std::unique_ptr<build_node> make_leaf(const build_context &ctx, std::uint32_t first, std::uint32_t count)
+		{
+			auto result = std::make_unique<build_node>();
+			result->bounds = detail::bounds_empty<T, 3, Abi>();
+			for (auto i = first; i < first + count; ++i) result->bounds = detail::bounds_union(result->bounds, ctx.bounds[ctx.refs[i]]);
+			result->first = first;
+			result->count = count;
+			return result;
+		}
+		[[nodiscard]] static std::unique_ptr<build_node> build_range(build_context &ctx, std::uint32_t first, std::uint32_t count, std::size_t spawn_depth)
+		{
+			if (count <= 2) return make_leaf(ctx, first, count);
+
+			const auto refs = ctx.refs.data() + first;
+			auto bounds = detail::bounds_empty<T, 3, Abi>();
+			auto cmin = vector_type{std::numeric_limits<T>::max()}, cmax = vector_type{std::numeric_limits<T>::lowest()};
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				bounds = detail::bounds_union(bounds, ctx.bounds[refs[i]]);
+				cmin = sek::min(cmin, ctx.centers[refs[i]]);
+				cmax = sek::max(cmax, ctx.centers[refs[i]]);
+			}
+
+			/* Find the split with the lowest SAH cost across all axes. Costs are relative to the parent area, which is omitted. */
+			const auto extent = cmax - cmin;
+			const auto leaf_cost = static_cast<T>(count) * detail::bounds_area(bounds);
+			auto best_cost = std::numeric_limits<T>::infinity();
+			std::size_t best_axis = 0, best_bin = 0;
+			for (std::size_t a = 0; a < 3; ++a)
+			{
+				if (!(extent[a] > T{0})) continue;
+
+				bounds_type bin_bounds[sah_bins];
+				std::uint32_t bin_count[sah_bins] = {};
+				std::fill_n(bin_bounds, sah_bins, detail::bounds_empty<T, 3, Abi>());
+
+				const auto scale = static_cast<T>(sah_bins) / extent[a];
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					const auto b = bin_index(ctx.centers[refs[i]][a], cmin[a], scale);
+					bin_bounds[b] = detail::bounds_union(bin_bounds[b], ctx.bounds[refs[i]]);
+					++bin_count[b];
+				}
+
+				/* Sweep from the right to find areas of the right sides, then from the left to evaluate every split. */
+				T right_area[sah_bins];
+				std::uint32_t right_count[sah_bins];
+				auto acc = detail::bounds_empty<T, 3, Abi>();
+				std::uint32_t acc_count = 0;
+				for (auto b = sah_bins; b-- > 1;)
+				{
+					acc = detail::bounds_union(acc, bin_bounds[b]);
+					acc_count += bin_count[b];
+					right_area[b] = acc_count ? detail::bounds_area(acc) : T{0};
+					right_count[b] = acc_count;
+				}
+
+				acc = detail::bounds_empty<T, 3, Abi>();
+				acc_count = 0;
+				for (std::size_t b = 0; b < sah_bins - 1; ++b)
+				{
+					acc = detail::bounds_union(acc, bin_bounds[b]);
+					acc_count += bin_count[b];
+					if (acc_count == 0 || right_count[b + 1] == 0) continue;
+
+					const auto cost = static_cast<T>(acc_count) * detail::bounds_area(acc) + static_cast<T>(right_count[b + 1]) * right_area[b + 1];
+					if (cost < best_cost)
+					{
+						best_cost = cost;
+						best_axis = a;
+						best_bin = b;
+					}
+				}
+			}
+
+			if (count <= max_leaf_size && leaf_cost <= best_cost) return make_leaf(ctx, first, count);
+
+			std::uint32_t mid;
+			if (best_cost < std::numeric_limits<T>::infinity())
+			{
+				const auto scale = static_cast<T>(sah_bins) / extent[best_axis];
+				const auto pos = std::partition(refs, refs + count, [&](std::uint32_t r)
+				{
+					return bin_index(ctx.centers[r][best_axis], cmin[best_axis], scale) <= best_bin;
+				});
+				mid = static_cast<std::uint32_t>(pos - refs);
+			}
+			else
+			{
+				/* All centers coincide, split the primitives in half. */
+				mid = count / 2;
+			}
+
+			auto result = std::make_unique<build_node>();
+			result->bounds = bounds;
+			if (spawn_depth != 0 && count >= parallel_threshold)
+			{
+				/* Subtrees reference disjoint ranges of `refs`, so they can be built concurrently.
+				 * Every spawning level doubles the number of threads, so spawning stops once all hardware threads are busy. */
+				auto left = std::async(std::launch::async, [&ctx, first, mid, spawn_depth]() { return build_range(ctx, first, mid, spawn_depth - 1); });
+				result->right = build_range(ctx, first + mid, count - mid, spawn_depth - 1);
+				result->left = left.get();
+			}
+			else
+			{
+				result->left = build_range(ctx, first, mid, 0);
+				result->right = build_range(ctx, first + mid, count - mid, 0);
+			}
+			return result;
+		}
+		[[nodiscard]] static std::size_t bin_index(T c, T cmin, T scale) noexcept
+		{
+			const auto b = static_cast<std::size_t>((c - cmin) * scale);
+			return std::min(b, sah_bins - 1);
+		}
+
+		std::uint32_t flatten(const build_node &root)
+		{
+			/* Collapse up to 4 levels of the binary tree into a single node, always expanding the child with the largest area. */
+			const build_node *children[node_width] = {root.left.get(), root.right.get()};
+			std::size_t n_children = 2;
+			while (n_children < node_width)
+			{
+				std::size_t best = node_width;
+				auto best_area = T{-1};
+				for (std::size_t i = 0; i < n_children; ++i)
+					if (const auto area = detail::bounds_area(children[i]->bounds); children[i]->left && area > best_area)
+					{
+						best = i;
+						best_area = area;
+					}
+				if (best == node_width) break;
+
+				const auto expanded = children[best];
+				children[best] = expanded->left.get();
+				children[n_children++] = expanded->right.get();
+			}
+
+			const auto idx = static_cast<std::uint32_t>(m_nodes.size());
+			m_nodes.push_back(empty_node());
+			for (std::size_t i = 0; i < n_children; ++i)
+			{
+				const auto &c = *children[i];
+				if (c.left)
+				{
+					const auto child = flatten(c);
+					set_child(m_nodes[idx], i, c.bounds, child, 0);
+				}
+				else
+					set_child(m_nodes[idx], i, c.bounds, c.first, c.count);
+			}
+			return idx;
+		}
+
+		std::vector<node_type> m_nodes;
+		std::vector<bounds_type> m_bounds;
+		std::vector<std::uint32_t> m_index;
+		std::vector<std::uint32_t> m_refs;
+	};
+
+	/** Alias for bounding volume hierarchy over `bbox<T>`. */
+	template<typename T>
+	using bvh = basic_bvh<T, math_abi::deduce_t<T, 3, math_abi::fixed_size<3>>>;
+}
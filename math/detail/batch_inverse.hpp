@@ -0,0 +1,176 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "inverse.hpp"
+#include "blend.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Every matrix element of the lane-parallel kernels is a lane of `native_vec<T>`, indexed as `m[column][row]`. */
+		template<typename L>
+		[[nodiscard]] SEK_FORCEINLINE L inverse_lanes(const L (&m)[2][2], L (&out)[2][2]) noexcept
+		{
+			const auto det = fmsub(m[0][0], m[1][1], m[1][0] * m[0][1]);
+			out[0][0] = m[1][1];
+			out[0][1] = -m[0][1];
+			out[1][0] = -m[1][0];
+			out[1][1] = m[0][0];
+			return det;
+		}
+		template<typename L>
+		[[nodiscard]] SEK_FORCEINLINE L inverse_lanes(const L (&m)[3][3], L (&out)[3][3]) noexcept
+		{
+			/* Rows of the adjugate are cross products of the columns. */
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				const auto &a = m[(i + 1) % 3];
+				const auto &b = m[(i + 2) % 3];
+				out[0][i] = fmsub(a[1], b[2], a[2] * b[1]);
+				out[1][i] = fmsub(a[2], b[0], a[0] * b[2]);
+				out[2][i] = fmsub(a[0], b[1], a[1] * b[0]);
+			}
+			return fmadd(m[0][0], out[0][0], fmadd(m[0][1], out[1][0], m[0][2] * out[2][0]));
+		}
+		template<typename L>
+		[[nodiscard]] SEK_FORCEINLINE L inverse_lanes(const L (&m)[4][4], L (&out)[4][4]) noexcept
+		{
+			/* Columns are split into 3D parts `a`, `b`, `c`, `d` and the bottom row `x`, `y`, `z`, `w`. The adjugate is then
+			 * expressed through 3D cross and dot products of the parts, which requires no shuffles within a lane. */
+			const auto cross3 = [](const L *u, const L *v, L (&r)[3]) noexcept
+			{
+				r[0] = fmsub(u[1], v[2], u[2] * v[1]);
+				r[1] = fmsub(u[2], v[0], u[0] * v[2]);
+				r[2] = fmsub(u[0], v[1], u[1] * v[0]);
+			};
+			const auto dot3 = [](const L *u, const L *v) noexcept { return fmadd(u[0], v[0], fmadd(u[1], v[1], u[2] * v[2])); };
+
+			const L *a = m[0], *b = m[1], *c = m[2], *d = m[3];
+			const auto &x = m[0][3], &y = m[1][3], &z = m[2][3], &w = m[3][3];
+
+			L s[3], t[3], u[3], v[3];
+			cross3(a, b, s);
+			cross3(c, d, t);
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				u[i] = fmsub(a[i], y, b[i] * x);
+				v[i] = fmsub(c[i], w, d[i] * z);
+			}
+
+			L r[3];
+			cross3(b, v, r);
+			for (std::size_t i = 0; i < 3; ++i) out[i][0] = fmadd(t[i], y, r[i]);
+			out[3][0] = -dot3(b, t);
+
+			cross3(v, a, r);
+			for (std::size_t i = 0; i < 3; ++i) out[i][1] = fnmadd(t[i], x, r[i]);
+			out[3][1] = dot3(a, t);
+
+			cross3(d, u, r);
+			for (std::size_t i = 0; i < 3; ++i) out[i][2] = fmadd(s[i], w, r[i]);
+			out[3][2] = -dot3(d, s);
+
+			cross3(u, c, r);
+			for (std::size_t i = 0; i < 3; ++i) out[i][3] = fnmadd(s[i], z, r[i]);
+			out[3][3] = dot3(c, s);
+
+			return fmadd(s[0], v[0], fmadd(s[1], v[1], fmadd(s[2], v[2], fmadd(t[0], u[0], fmadd(t[1], u[1], t[2] * u[2])))));
+		}
+
+		/* Inverts matrices in groups of `native_vec<T>::size()`. Every group is transposed into SoA lane buffers, inverted
+		 * lane-parallel and transposed back. Optional determinant and singularity outputs are written for every matrix. */
+		template<typename T, std::size_t N, typename A>
+		inline void inverse_batch(std::span<const basic_mat<T, N, N, A>> in, std::span<basic_mat<T, N, N, A>> out, T *det_out, bool *sing_out) noexcept
+		{
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+
+			SEK_ASSERT(out.size() >= in.size());
+
+			alignas(align) T buff[N][N][w];
+			alignas(align) T det_buff[w];
+			bool sing_buff[w];
+			for (std::size_t i = 0; i < in.size(); i += w)
+			{
+				const auto n = std::min(w, in.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(&buff[0][0][0], N * N * w, T{0});
+
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t c = 0; c < N; ++c)
+						for (std::size_t r = 0; r < N; ++r) buff[c][r][k] = in[i + k][c][r];
+
+				lane_t m[N][N], inv[N][N];
+				for (std::size_t c = 0; c < N; ++c)
+					for (std::size_t r = 0; r < N; ++r) to_simd(m[c][r]).copy_from(buff[c][r], dpm::vector_aligned);
+
+				const auto det = inverse_lanes(m, inv);
+				/* Only matrices without a finite inverse determinant are singular, an absolute threshold would reject uniformly small matrices. */
+				const auto rdet = lane_t{T{1}} / det;
+				const auto max = lane_t{std::numeric_limits<T>::max()};
+				const auto sing = !(abs(det) <= max && abs(rdet) <= max);
+				const auto ik = blend(rdet, lane_t{T{0}}, sing);
+
+				for (std::size_t c = 0; c < N; ++c)
+					for (std::size_t r = 0; r < N; ++r) to_simd(inv[c][r] * ik).copy_to(buff[c][r], dpm::vector_aligned);
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t c = 0; c < N; ++c)
+						for (std::size_t r = 0; r < N; ++r) out[i + k][c][r] = buff[c][r][k];
+
+				if (det_out)
+				{
+					to_simd(det).copy_to(det_buff, dpm::vector_aligned);
+					std::copy_n(det_buff, n, det_out + i);
+				}
+				if (sing_out)
+				{
+					to_simd(sing).copy_to(sing_buff, dpm::element_aligned);
+					std::copy_n(sing_buff, n, sing_out + i);
+				}
+			}
+		}
+	}
+
+#pragma region "batched inverse functions"
+	/** Calculates inverse matrices of \a in and writes them to \a out. Equivalent to `out[i] = inverse(in[i])` for every non-singular element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in.
+	 * @note Singular matrices (matrices with a zero or non-finite determinant, or a determinant whose reciprocal overflows)
+	 * are inverted to zero, while `inverse` produces non-finite elements for them. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void inverse_batch(std::span<const basic_mat<T, N, N, A>> in, std::span<basic_mat<T, N, N, A>> out) noexcept requires (N >= 2 && N <= 4)
+	{
+		detail::inverse_batch<T, N, A>(in, out, nullptr, nullptr);
+	}
+	/** @copydoc inverse_batch
+	 * @param det Span receiving determinants of the source matrices. Must be at least `in.size()` elements long. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void inverse_batch(std::span<const basic_mat<T, N, N, A>> in, std::span<basic_mat<T, N, N, A>> out, std::span<T> det) noexcept requires (N >= 2 && N <= 4)
+	{
+		SEK_ASSERT(det.size() >= in.size());
+		detail::inverse_batch<T, N, A>(in, out, det.data(), nullptr);
+	}
+	/** @copydoc inverse_batch
+	 * @param singular Span receiving the singularity mask of the source matrices. Must be at least `in.size()` elements long. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void inverse_batch(std::span<const basic_mat<T, N, N, A>> in, std::span<basic_mat<T, N, N, A>> out, std::span<bool> singular) noexcept requires (N >= 2 && N <= 4)
+	{
+		SEK_ASSERT(singular.size() >= in.size());
+		detail::inverse_batch<T, N, A>(in, out, nullptr, singular.data());
+	}
+	/** @copydoc inverse_batch
+	 * @param det Span receiving determinants of the source matrices. Must be at least `in.size()` elements long.
+	 * @param singular Span receiving the singularity mask of the source matrices. Must be at least `in.size()` elements long. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void inverse_batch(std::span<const basic_mat<T, N, N, A>> in, std::span<basic_mat<T, N, N, A>> out, std::span<T> det, std::span<bool> singular) noexcept requires (N >= 2 && N <= 4)
+	{
+		SEK_ASSERT(det.size() >= in.size() && singular.size() >= in.size());
+		detail::inverse_batch<T, N, A>(in, out, det.data(), singular.data());
+	}
+#pragma endregion
+}
@@ -0,0 +1,193 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+
+#include "type_mat.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Transforms vectors from `in` by matrix `m` in blocks of `native_vec<T>::size()` vectors. For every block, the
+		 * components of the input vectors are de-interleaved into lanes, and every output component is computed as a chain of
+		 * FMAs against broadcast matrix elements. Broadcasts are hoisted out of the loop, so the matrix stays in registers.
+		 *
+		 * `NU` is the amount of input components multiplied by the matrix, `Translate` specifies whether column `NU` is added
+		 * to the result (implicit `w = 1`) and `Project` specifies whether the result is divided by the last matrix row. */
+		template<std::size_t NU, bool Translate, bool Project, typename T, std::size_t NC, std::size_t NR, typename AM, std::size_t NI, typename AI, std::size_t NO, typename AO>
+		inline void transform_batch(const basic_mat<T, NC, NR, AM> &m, std::span<const basic_vec<T, NI, AI>> in, std::span<basic_vec<T, NO, AO>> out) noexcept
+		{
+			static_assert(NU <= NI && NU + Translate <= NC && NO <= NR);
+
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+			constexpr auto n_rows = Project ? NR : NO;
+			constexpr auto n_cols = Translate ? NU + 1 : NU;
+
+			SEK_ASSERT(out.size() >= in.size());
+
+			lane_t bm[n_cols][n_rows];
+			for (std::size_t c = 0; c < n_cols; ++c)
+				for (std::size_t r = 0; r < n_rows; ++r) bm[c][r] = lane_t{m[c][r]};
+
+			alignas(align) T buff[std::max(NU, NO)][w];
+			for (std::size_t i = 0; i < in.size(); i += w)
+			{
+				const auto n = std::min(w, in.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(&buff[0][0], std::max(NU, NO) * w, T{0});
+
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t c = 0; c < NU; ++c) buff[c][k] = in[i + k][c];
+
+				lane_t x[NU];
+				for (std::size_t c = 0; c < NU; ++c) to_simd(x[c]).copy_from(buff[c], dpm::vector_aligned);
+
+				lane_t y[n_rows];
+				for (std::size_t r = 0; r < n_rows; ++r)
+				{
+					/* Without translation, the first product initializes the accumulator. */
+					constexpr std::size_t c0 = Translate ? 0 : 1;
+					lane_t acc;
+					if constexpr (Translate)
+						acc = bm[NU][r];
+					else
+						acc = x[0] * bm[0][r];
+					for (auto c = c0; c < NU; ++c) acc = fmadd(x[c], bm[c][r], acc);
+					y[r] = acc;
+				}
+				if constexpr (Project)
+				{
+					const auto inv_w = lane_t{T{1}} / y[NR - 1];
+					for (std::size_t r = 0; r < NO; ++r) y[r] *= inv_w;
+				}
+
+				for (std::size_t r = 0; r < NO; ++r) to_simd(y[r]).copy_to(buff[r], dpm::vector_aligned);
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t r = 0; r < NO; ++r) out[i + k][r] = buff[r][k];
+			}
+		}
+
+		/* Multiplies columns `a` by matrix `b`. Broadcast elements of `b` are created in-place, columns of `a` are expected to be kept in registers by the caller. */
+		template<typename T, typename A>
+		[[nodiscard]] SEK_FORCEINLINE basic_mat<T, 4, 4, A> mul_mat4(const basic_vec<T, 4, A> (&a)[4], const basic_mat<T, 4, 4, A> &b) noexcept
+		{
+			basic_mat<T, 4, 4, A> result;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				const auto &bi = b[i];
+				result[i] = fmadd(a[3], basic_vec<T, 4, A>{bi[3]}, fmadd(a[2], basic_vec<T, 4, A>{bi[2]}, fmadd(a[1], basic_vec<T, 4, A>{bi[1]}, a[0] * basic_vec<T, 4, A>{bi[0]})));
+			}
+			return result;
+		}
+		/* Multiplies matrix `a` by pre-broadcast elements of `b`. */
+		template<typename T, typename A>
+		[[nodiscard]] SEK_FORCEINLINE basic_mat<T, 4, 4, A> mul_mat4(const basic_mat<T, 4, 4, A> &a, const basic_vec<T, 4, A> (&b)[4][4]) noexcept
+		{
+			basic_mat<T, 4, 4, A> result;
+			for (std::size_t i = 0; i < 4; ++i)
+				result[i] = fmadd(a[3], b[i][3], fmadd(a[2], b[i][2], fmadd(a[1], b[i][1], a[0] * b[i][0])));
+			return result;
+		}
+	}
+
+#pragma region "batched transform functions"
+	/** Transforms 3D points from \a in by matrix \a m and writes them to \a out. Equivalent to `(m * vec4{in[i], 1}).xyz()` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AI, typename AO>
+	inline void transform_points(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, true, false>(m, in, out);
+	}
+	/** Transforms homogeneous points from \a in by matrix \a m and writes them to \a out. Equivalent to `m * in[i]` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AI, typename AO>
+	inline void transform_points(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 4, AI>> in, std::span<basic_vec<T, 4, AO>> out) noexcept
+	{
+		detail::transform_batch<4, false, false>(m, in, out);
+	}
+
+	/** Transforms 3D directions from \a in by matrix \a m and writes them to \a out. Equivalent to `(m * vec4{in[i], 0}).xyz()` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AI, typename AO>
+	inline void transform_directions(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, false, false>(m, in, out);
+	}
+	/** Transforms homogeneous directions from \a in by matrix \a m and writes them to \a out. Equivalent to `m * vec4{in[i].xyz(), 0}` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AI, typename AO>
+	inline void transform_directions(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 4, AI>> in, std::span<basic_vec<T, 4, AO>> out) noexcept
+	{
+		detail::transform_batch<3, false, false>(m, in, out);
+	}
+	/** Transforms 3D directions from \a in by matrix \a m and writes them to \a out. Equivalent to `m * in[i]` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<typename T, typename AM, typename AI, typename AO>
+	inline void transform_directions(const basic_mat<T, 3, 3, AM> &m, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, false, false>(m, in, out);
+	}
+
+	/** Transforms 3D points from \a in by projection matrix \a m, performs the homogeneous divide and writes them to \a out.
+	 * Equivalent to `r.xyz() / r.w()` where `r = m * vec4{in[i], 1}` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<std::floating_point T, typename AM, typename AI, typename AO>
+	inline void transform_projective(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 3, AI>> in, std::span<basic_vec<T, 3, AO>> out) noexcept
+	{
+		detail::transform_batch<3, true, true>(m, in, out);
+	}
+	/** Transforms homogeneous points from \a in by projection matrix \a m, performs the homogeneous divide and writes them to \a out.
+	 * Equivalent to `r / r.w()` where `r = m * in[i]` for every element `i`.
+	 * @note \a out must be at least `in.size()` elements long and may alias \a in. */
+	template<std::floating_point T, typename AM, typename AI, typename AO>
+	inline void transform_projective(const basic_mat<T, 4, 4, AM> &m, std::span<const basic_vec<T, 4, AI>> in, std::span<basic_vec<T, 4, AO>> out) noexcept
+	{
+		detail::transform_batch<4, false, true>(m, in, out);
+	}
+#pragma endregion
+
+#pragma region "batched matrix multiplication"
+	/** Multiplies matrices from \a a by matrices from \a b and writes the products to \a out. Equivalent to `out[i] = a[i] * b[i]` for every element `i`.
+	 * @note \a a and \a b must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b. */
+	template<typename T, typename A>
+	inline void multiply_batch(std::span<const basic_mat<T, 4, 4, A>> a, std::span<const basic_mat<T, 4, 4, A>> b, std::span<basic_mat<T, 4, 4, A>> out) noexcept
+	{
+		SEK_ASSERT(a.size() == b.size() && out.size() >= a.size());
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			const basic_vec<T, 4, A> ca[4] = {a[i][0], a[i][1], a[i][2], a[i][3]};
+			out[i] = detail::mul_mat4(ca, b[i]);
+		}
+	}
+	/** Multiplies matrix \a a by matrices from \a b and writes the products to \a out. Equivalent to `out[i] = a * b[i]` for every element `i`.
+	 * @note \a out must be at least `b.size()` elements long and may alias \a b. */
+	template<typename T, typename A>
+	inline void multiply_batch(const basic_mat<T, 4, 4, A> &a, std::span<const basic_mat<T, 4, 4, A>> b, std::span<basic_mat<T, 4, 4, A>> out) noexcept
+	{
+		SEK_ASSERT(out.size() >= b.size());
+
+		/* Columns of the shared matrix are loaded once and kept in registers for the entire batch. */
+		const basic_vec<T, 4, A> ca[4] = {a[0], a[1], a[2], a[3]};
+		for (std::size_t i = 0; i < b.size(); ++i) out[i] = detail::mul_mat4(ca, b[i]);
+	}
+	/** Multiplies matrices from \a a by matrix \a b and writes the products to \a out. Equivalent to `out[i] = a[i] * b` for every element `i`.
+	 * @note \a out must be at least `a.size()` elements long and may alias \a a. */
+	template<typename T, typename A>
+	inline void multiply_batch(std::span<const basic_mat<T, 4, 4, A>> a, const basic_mat<T, 4, 4, A> &b, std::span<basic_mat<T, 4, 4, A>> out) noexcept
+	{
+		SEK_ASSERT(out.size() >= a.size());
+
+		/* Elements of the shared matrix are broadcast once and kept in registers for the entire batch. */
+		basic_vec<T, 4, A> bb[4][4];
+		for (std::size_t i = 0; i < 4; ++i)
+			for (std::size_t j = 0; j < 4; ++j) bb[i][j] = basic_vec<T, 4, A>{b[i][j]};
+		for (std::size_t i = 0; i < a.size(); ++i) out[i] = detail::mul_mat4(a[i], bb);
+	}
+#pragma endregion
+}
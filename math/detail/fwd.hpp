@@ -52,9 +52,16 @@ namespace sek
 	class basic_mat;
 	template<std::floating_point T, typename Abi>
 	class basic_quat;
+	template<std::floating_point T, typename Abi>
+	class basic_affine3;
+	template<std::floating_point T, typename Abi>
+	class basic_dual_quat;
 	template<typename T, std::size_t N, typename Abi>
 	class basic_bounds;
 
+	template<typename T>
+	struct serial_traits;
+
 	template<typename T, std::size_t N, typename Abi>
 	[[nodiscard]] constexpr typename basic_vec_mask<T, N, Abi>::simd_type &to_simd(basic_vec_mask<T, N, Abi> &x) noexcept;
 	template<typename T, std::size_t N, typename Abi>
@@ -11,7 +11,7 @@ namespace sek
 {
 	/** Calculates the 2x2 inverse matrix of \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline basic_mat<T, 2, 2, A> inverse(const basic_mat<T, 2, 2, A> &x) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 2, 2, A> inverse(const basic_mat<T, 2, 2, A> &x) noexcept
 	{
 		const auto k = static_cast<T>(1) / (detail::fmsub(x[0][0], x[1][1], x[1][0] * x[0][1]));
 		const auto c0 = basic_vec<T, 2, A>{x[1][1] * k, -x[0][1] * k};
@@ -20,7 +20,7 @@ namespace sek
 	}
 	/** Calculates the 3x3 inverse matrix of \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline basic_mat<T, 3, 3, A> inverse(const basic_mat<T, 3, 3, A> &x) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 3, 3, A> inverse(const basic_mat<T, 3, 3, A> &x) noexcept
 	{
 		const auto a0 = basic_vec<T, 3, A>{x[1][0], x[0][0], x[0][0]};
 		const auto a1 = basic_vec<T, 3, A>{x[1][1], x[0][1], x[0][1]};
@@ -41,7 +41,7 @@ namespace sek
 	}
 	/** Calculates the 4x4 inverse matrix of \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline basic_mat<T, 4, 4, A> inverse(const basic_mat<T, 4, 4, A> &x) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 4, 4, A> inverse(const basic_mat<T, 4, 4, A> &x) noexcept
 	{
 		using vec2_t = basic_vec<T, 2, math_abi::deduce_t<T, 2, A>>;
 
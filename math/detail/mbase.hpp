@@ -10,10 +10,18 @@ namespace sek
 {
 	/** Calculates absolute value of elements in vector \a x. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> abs(const basic_vec<T, N, A> &x) noexcept { return {dpm::abs(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> abs(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T v) { return v < T{0} ? -v : v; }, x);
+		return {dpm::abs(to_simd(x))};
+	}
 	/** @copydoc abs */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fabs(const basic_vec<T, N, A> &x) noexcept { return {dpm::fabs(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> fabs(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return abs(x);
+		return {dpm::fabs(to_simd(x))};
+	}
 
 	/** Calculates floating-point remainder of elements in \a a divided by elements in vector \a b. */
 	template<std::floating_point T, std::size_t N, typename A>
@@ -70,8 +78,9 @@ namespace sek
 
 	/** Preforms linear interpolation or extrapolation between elements of vectors \a a and \a b using factor \a f */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> lerp(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &f) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> lerp(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &f) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T x, T y, T t) { return x + t * (y - x); }, a, b, f);
 		return {dpm::lerp(to_simd(a), to_simd(b), to_simd(f))};
 	}
 	/** @copydoc lerp
@@ -123,8 +132,9 @@ namespace sek
 
 	/** Preforms linear interpolation or extrapolation between elements of vectors \a a and \a b using scalar factor \a f */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> lerp(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, T f) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> lerp(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, T f) noexcept
 	{
+		if (std::is_constant_evaluated()) return lerp(a, b, basic_vec<T, N, A>{f});
 		return {dpm::lerp(to_simd(a), to_simd(b), f)};
 	}
 	/** @copydoc lerp
@@ -137,32 +147,37 @@ namespace sek
 
 	/** Returns a result of fused multiply-add operation on elements of \a a, \a b and \a c. Equivalent to `a * b + c`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fmadd(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> fmadd(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b + c;
 		return {dpm::fmadd(to_simd(a), to_simd(b), to_simd(c))};
 	}
 	/** Returns a result of fused multiply-sub operation on elements of \a a, \a b and \a c. Equivalent to `a * b - c`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fmsub(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> fmsub(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b - c;
 		return {dpm::fmsub(to_simd(a), to_simd(b), to_simd(c))};
 	}
 	/** Returns a result of fused negate-multiply-add operation on elements of \a a, \a b and \a c. Equivalent to `-(a * b) + c`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fnmadd(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> fnmadd(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) + c;
 		return {dpm::fnmadd(to_simd(a), to_simd(b), to_simd(c))};
 	}
 	/** Returns a result of fused negate-multiply-sub operation on elements of \a a, \a b and \a c. Equivalent to `-(a * b) - c`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fnmsub(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> fnmsub(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) - c;
 		return {dpm::fnmsub(to_simd(a), to_simd(b), to_simd(c))};
 	}
 	/** @copydoc fmadd */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> fma(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
+	[[nodiscard]] constexpr basic_vec<T, N, A> fma(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b, const basic_vec<T, N, A> &c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b + c;
 		return {dpm::fma(to_simd(a), to_simd(b), to_simd(c))};
 	}
 
@@ -0,0 +1,37 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "define.hpp"
+
+namespace sek::detail
+{
+	/* Returns the number of chunks of at least `grain` elements used to process `n` elements in parallel. */
+	[[nodiscard]] inline std::size_t parallel_chunk_count(std::size_t n, std::size_t grain) noexcept
+	{
+		return std::clamp<std::size_t>(n / grain, 1, std::max(1u, std::thread::hardware_concurrency()));
+	}
+
+	/* Invokes `f(chunk, first, last)` for `n_chunks` contiguous chunks of `[0, n)`. Chunk `0` is processed on the calling thread. */
+	template<typename F>
+	inline void parallel_chunks(std::size_t n, std::size_t n_chunks, F &&f)
+	{
+		const auto chunk_size = (n + n_chunks - 1) / n_chunks;
+		std::vector<std::future<void>> tasks;
+		tasks.reserve(n_chunks - 1);
+		for (std::size_t c = 1; c < n_chunks; ++c)
+		{
+			const auto first = std::min(n, c * chunk_size), last = std::min(n, first + chunk_size);
+			tasks.push_back(std::async(std::launch::async, [&f, c, first, last]() { f(c, first, last); }));
+		}
+		f(std::size_t{0}, std::size_t{0}, std::min(n, chunk_size));
+		for (auto &t: tasks) t.get();
+	}
+}
@@ -0,0 +1,144 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "xoroshiro.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Philox rounds are evaluated on 64-bit values (or lanes) holding 32-bit words, so that the 32x32 -> 64 bit
+		 * multiplication does not require a dedicated `mulhi` instruction. Works for both `std::uint64_t` and `basic_vec`. */
+		template<std::size_t Rounds, typename L>
+		SEK_FORCEINLINE void philox4x32_rounds(L (&c)[4], L k0, L k1) noexcept
+		{
+			const auto mask = L{0xffff'ffff};
+			for (std::size_t i = 0; i < Rounds; ++i)
+			{
+				const auto p0 = c[0] * L{0xd251'1f53};
+				const auto p1 = c[2] * L{0xcd9e'8d57};
+
+				const auto c1 = c[1], c3 = c[3];
+				c[0] = (p1 >> L{32}) ^ c1 ^ k0;
+				c[1] = p1 & mask;
+				c[2] = (p0 >> L{32}) ^ c3 ^ k1;
+				c[3] = p0 & mask;
+
+				k0 = (k0 + L{0x9e37'79b9}) & mask;
+				k1 = (k1 + L{0xbb67'ae85}) & mask;
+			}
+		}
+	}
+
+	/** @brief Philox-4x32 counter-based random number generator.
+	 *
+	 * Counter-based generators have no sequential state. Every 128-bit counter is mapped to 4 independent random 32-bit
+	 * words by a keyed bijection, which allows any element of a parallel loop to draw reproducible random numbers
+	 * (for example, using it's index as the counter) without shared state or synchronization.
+	 *
+	 * @tparam Rounds Number of rounds of the bijection. 10 rounds (default) pass BigCrush, 7 rounds is the suggested minimum.
+	 * @note See Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11). */
+	template<std::size_t Rounds = 10>
+	class basic_philox4x32
+	{
+	public:
+		using key_type = vec2<std::uint32_t>;
+		using counter_type = vec4<std::uint32_t>;
+		using result_type = vec4<std::uint32_t>;
+
+	private:
+		template<typename U, typename F>
+		static void generate_batch(const key_type &key, const counter_type &base, std::span<U> out, F &&convert) noexcept
+		{
+			using lane_t = native_vec<std::uint64_t>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+
+			/* Counters of a batch are `base + i`, where `i` is added to the low 64 bits of the counter. */
+			const auto first = static_cast<std::uint64_t>(base[0]) | static_cast<std::uint64_t>(base[1]) << 32;
+			const auto k0 = lane_t{key[0]}, k1 = lane_t{key[1]};
+			const auto c2 = lane_t{base[2]}, c3 = lane_t{base[3]};
+
+			constexpr auto per_ctr = 4 / (sizeof(U) / sizeof(std::uint32_t));
+			const auto n_ctr = (out.size() + per_ctr - 1) / per_ctr;
+
+			alignas(align) std::uint64_t buff[4][w];
+			for (std::size_t i = 0; i < n_ctr; i += w)
+			{
+				for (std::size_t j = 0; j < w; ++j)
+				{
+					const auto ctr = first + i + j;
+					buff[0][j] = ctr & 0xffff'ffff;
+					buff[1][j] = ctr >> 32;
+				}
+
+				lane_t c[4] = {{}, {}, c2, c3};
+				to_simd(c[0]).copy_from(buff[0], dpm::vector_aligned);
+				to_simd(c[1]).copy_from(buff[1], dpm::vector_aligned);
+				detail::philox4x32_rounds<Rounds>(c, k0, k1);
+				for (std::size_t k = 0; k < 4; ++k) to_simd(c[k]).copy_to(buff[k], dpm::vector_aligned);
+
+				const auto n = std::min(w, n_ctr - i);
+				for (std::size_t j = 0; j < n; ++j)
+					for (std::size_t k = 0; k < per_ctr; ++k)
+						if (const auto idx = (i + j) * per_ctr + k; idx < out.size()) [[likely]]
+							out[idx] = convert(buff, j, k);
+			}
+		}
+
+	public:
+		/** Returns 4 random 32-bit words for counter \a ctr using key \a key. */
+		[[nodiscard]] static result_type generate(const key_type &key, const counter_type &ctr) noexcept
+		{
+			std::uint64_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+			detail::philox4x32_rounds<Rounds, std::uint64_t>(c, key[0], key[1]);
+			return {c[0], c[1], c[2], c[3]};
+		}
+		/** Returns 4 random single-precision values within [0, 1) for counter \a ctr using key \a key.
+		 * Every word is converted the same way as by `xoroshiro<float, 128>`. */
+		[[nodiscard]] static vec4<float> generate_float(const key_type &key, const counter_type &ctr) noexcept
+		{
+			return detail::vec_bits_to_unit<float>(generate(key, ctr));
+		}
+		/** Returns 2 random double-precision values within [0, 1) for counter \a ctr using key \a key.
+		 * Every pair of words is combined (low word first) and converted the same way as by `xoroshiro<double, 256>`. */
+		[[nodiscard]] static vec2<double> generate_double(const key_type &key, const counter_type &ctr) noexcept
+		{
+			const auto r = generate(key, ctr);
+			const auto v0 = static_cast<std::uint64_t>(r[0]) | static_cast<std::uint64_t>(r[1]) << 32;
+			const auto v1 = static_cast<std::uint64_t>(r[2]) | static_cast<std::uint64_t>(r[3]) << 32;
+			return {detail::uint64_to_double(v0), detail::uint64_to_double(v1)};
+		}
+
+		/** Fills \a out with random 32-bit words generated for consecutive counters starting at \a base using key \a key.
+		 * Counters are generated lane-parallel, and every counter produces 4 consecutive elements of \a out.
+		 * @note Consecutive counters are produced by incrementing the low 64 bits of \a base. */
+		static void generate(const key_type &key, const counter_type &base, std::span<std::uint32_t> out) noexcept
+		{
+			generate_batch(key, base, out, [](const auto &buff, std::size_t j, std::size_t k) { return static_cast<std::uint32_t>(buff[k][j]); });
+		}
+		/** Fills \a out with random single-precision values within [0, 1). Equivalent to `generate_float` for consecutive counters.
+		 * @copydetails generate */
+		static void generate(const key_type &key, const counter_type &base, std::span<float> out) noexcept
+		{
+			generate_batch(key, base, out, [](const auto &buff, std::size_t j, std::size_t k) { return detail::uint32_to_float(static_cast<std::uint32_t>(buff[k][j])); });
+		}
+		/** Fills \a out with random double-precision values within [0, 1). Equivalent to `generate_double` for consecutive counters.
+		 * @copydetails generate */
+		static void generate(const key_type &key, const counter_type &base, std::span<double> out) noexcept
+		{
+			generate_batch(key, base, out, [](const auto &buff, std::size_t j, std::size_t k)
+			{
+				return detail::uint64_to_double(buff[k * 2][j] | buff[k * 2 + 1][j] << 32);
+			});
+		}
+	};
+
+	/** Alias for the 10-round Philox-4x32 counter-based random number generator. */
+	using philox4x32 = basic_philox4x32<10>;
+}
@@ -10,13 +10,21 @@ namespace sek
 {
 	/** Calculates square root of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> sqrt(const basic_vec<T, N, A> &x) noexcept { return {dpm::sqrt(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> sqrt(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T v) { return detail::const_sqrt(v); }, x);
+		return {dpm::sqrt(to_simd(x))};
+	}
 	/** Calculates cube root of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
 	[[nodiscard]] inline basic_vec<T, N, A> cbrt(const basic_vec<T, N, A> &x) noexcept { return {dpm::cbrt(to_simd(x))}; }
 	/** Calculates reciprocal square root of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> rsqrt(const basic_vec<T, N, A> &x) noexcept { return {dpm::rsqrt(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> rsqrt(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T v) { return T{1} / detail::const_sqrt(v); }, x);
+		return {dpm::rsqrt(to_simd(x))};
+	}
 
 	/** @copydoc sqrt
 	 * @note Arguments and return type are promoted to `double`, or `long double` if one of the arguments is `long double`. */
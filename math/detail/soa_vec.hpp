@@ -0,0 +1,406 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <new>
+#include <array>
+
+#include "geom.hpp"
+#include "blend.hpp"
+
+namespace sek
+{
+	template<typename>
+	class soa_array;
+
+	/** @brief Structure-of-arrays container of mathematical vectors.
+	 *
+	 * Every component of the stored vectors is kept in a separate stream aligned for the native SIMD ABI of `T`.
+	 * Streams are padded with zeros up to a multiple of the native SIMD width, which allows kernels operating on
+	 * `soa_array` to process `native_vec<T>::size()` vectors per instruction without tail handling or horizontal reductions.
+	 *
+	 * @tparam T Value type of the vectors.
+	 * @tparam N Dimension of the vectors.
+	 * @tparam Abi ABI tag of the vector type used for element access. */
+	template<typename T, std::size_t N, typename Abi>
+	class soa_array<basic_vec<T, N, Abi>>
+	{
+		static_assert(std::is_arithmetic_v<T>, "Structure-of-arrays container requires an arithmetic value type");
+
+	public:
+		using value_type = basic_vec<T, N, Abi>;
+		using lane_type = native_vec<T>;
+		using size_type = std::size_t;
+
+		/** Number of vectors processed by a single lane of the native SIMD ABI. */
+		constexpr static size_type lane_width = lane_type{}.size();
+		/** Alignment of every component stream of the container. */
+		constexpr static size_type stream_align = std::max(alignof(typename lane_type::simd_type), alignof(T));
+
+	private:
+		[[nodiscard]] constexpr static size_type round_lanes(size_type n) noexcept { return (n + lane_width - 1) / lane_width * lane_width; }
+
+		[[nodiscard]] static T *allocate(size_type cap)
+		{
+			const auto bytes = cap * N * sizeof(T);
+			auto *ptr = static_cast<T *>(::operator new(bytes, std::align_val_t{stream_align}));
+			std::fill_n(ptr, cap * N, T{0});
+			return ptr;
+		}
+		static void deallocate(T *ptr) noexcept { if (ptr) ::operator delete(ptr, std::align_val_t{stream_align}); }
+
+		void assert_idx(size_type i) const { if (i >= m_size) [[unlikely]] throw std::range_error("Element index out of range"); }
+
+	public:
+		constexpr soa_array() noexcept = default;
+		~soa_array() { deallocate(m_data); }
+
+		/** Initializes the container with \a n zero vectors. */
+		explicit soa_array(size_type n) { resize(n); }
+		/** Initializes the container from a span of vectors. */
+		soa_array(std::span<const value_type> data) { assign(data); }
+
+		soa_array(const soa_array &other) : m_size(other.m_size), m_capacity(other.m_capacity)
+		{
+			if (m_capacity != 0)
+			{
+				m_data = allocate(m_capacity);
+				std::copy_n(other.m_data, m_capacity * N, m_data);
+			}
+		}
+		soa_array &operator=(const soa_array &other)
+		{
+			if (this != &other) soa_array{other}.swap(*this);
+			return *this;
+		}
+		constexpr soa_array(soa_array &&other) noexcept { swap(other); }
+		constexpr soa_array &operator=(soa_array &&other) noexcept
+		{
+			swap(other);
+			return *this;
+		}
+
+		/** Returns the number of vectors in the container. */
+		[[nodiscard]] constexpr size_type size() const noexcept { return m_size; }
+		/** Returns the amount of vectors the container can store without re-allocation. Always a multiple of `lane_width`. */
+		[[nodiscard]] constexpr size_type capacity() const noexcept { return m_capacity; }
+		/** Checks if the container is empty. */
+		[[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+
+		/** Returns pointer to the `j`th component stream of the container.
+		 * @note Streams are aligned to `stream_align` and contain `capacity()` elements. */
+		[[nodiscard]] constexpr T *data(size_type j) noexcept
+		{
+			SEK_ASSUME(j < N);
+			return m_data + j * m_capacity;
+		}
+		/** @copydoc data */
+		[[nodiscard]] constexpr const T *data(size_type j) const noexcept
+		{
+			SEK_ASSUME(j < N);
+			return m_data + j * m_capacity;
+		}
+		/** Returns a span of the `j`th component of all vectors in the container. */
+		[[nodiscard]] constexpr std::span<T> stream(size_type j) noexcept { return {data(j), m_size}; }
+		/** @copydoc stream */
+		[[nodiscard]] constexpr std::span<const T> stream(size_type j) const noexcept { return {data(j), m_size}; }
+
+		/** Returns copy of the `i`th vector of the container.
+		 * @throw std::range_error In case \a i exceeds `size()`. */
+		[[nodiscard]] value_type at(size_type i) const
+		{
+			assert_idx(i);
+			return operator[](i);
+		}
+		/** Returns copy of the `i`th vector of the container. */
+		[[nodiscard]] value_type operator[](size_type i) const noexcept
+		{
+			value_type result;
+			for (size_type j = 0; j < N; ++j) result[j] = data(j)[i];
+			return result;
+		}
+		/** Replaces the `i`th vector of the container with \a value. */
+		void set(size_type i, const value_type &value) noexcept
+		{
+			for (size_type j = 0; j < N; ++j) data(j)[i] = value[j];
+		}
+
+		/** Replaces contents of the container with vectors from \a src. */
+		void assign(std::span<const value_type> src)
+		{
+			resize(src.size());
+			for (size_type i = 0; i < src.size(); ++i) set(i, src[i]);
+		}
+		/** Copies vectors of the container to \a dst.
+		 * @note \a dst must be at least `size()` elements long. */
+		void copy_to(std::span<value_type> dst) const noexcept
+		{
+			SEK_ASSERT(dst.size() >= m_size);
+			for (size_type i = 0; i < m_size; ++i) dst[i] = operator[](i);
+		}
+
+		/** Appends vector \a value to the end of the container. */
+		void push_back(const value_type &value)
+		{
+			if (m_size == m_capacity) reserve(std::max(m_capacity * 2, lane_width));
+			set(m_size++, value);
+		}
+		/** Removes all vectors from the container. */
+		void clear() noexcept { resize(0); }
+
+		/** Reserves space for at least \a n vectors. */
+		void reserve(size_type n)
+		{
+			if (n <= m_capacity) return;
+
+			const auto new_cap = round_lanes(n);
+			auto *new_data = allocate(new_cap);
+			for (size_type j = 0; j < N; ++j)
+				std::copy_n(data(j), m_size, new_data + j * new_cap);
+
+			deallocate(m_data);
+			m_data = new_data;
+			m_capacity = new_cap;
+		}
+		/** Resizes the container to \a n vectors. New vectors are zero-initialized. */
+		void resize(size_type n)
+		{
+			reserve(n);
+
+			/* Keep the padding zeroed, so that kernels never operate on stale values. */
+			if (n < m_size) for (size_type j = 0; j < N; ++j) std::fill(data(j) + n, data(j) + m_size, T{0});
+			m_size = n;
+		}
+
+		constexpr void swap(soa_array &other) noexcept
+		{
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+			std::swap(m_capacity, other.m_capacity);
+		}
+		friend constexpr void swap(soa_array &a, soa_array &b) noexcept { a.swap(b); }
+
+	private:
+		T *m_data = nullptr;
+		size_type m_size = 0;
+		size_type m_capacity = 0;
+	};
+
+	namespace detail
+	{
+		template<typename L, typename T>
+		[[nodiscard]] SEK_FORCEINLINE L soa_load(const T *src) noexcept
+		{
+			L result;
+			to_simd(result).copy_from(src, dpm::vector_aligned);
+			return result;
+		}
+		template<typename L, typename T>
+		SEK_FORCEINLINE void soa_store(const L &src, T *dst) noexcept { to_simd(src).copy_to(dst, dpm::vector_aligned); }
+
+		/* Stores a lane into an unaligned span that may be shorter than the lane. */
+		template<typename L, typename T>
+		SEK_FORCEINLINE void soa_store_n(const L &src, T *dst, std::size_t n) noexcept
+		{
+			if (n >= src.size()) [[likely]]
+				to_simd(src).copy_to(dst, dpm::element_aligned);
+			else
+				for (std::size_t i = 0; i < n; ++i) dst[i] = src[i];
+		}
+
+		template<std::size_t N, typename L, typename T>
+		[[nodiscard]] SEK_FORCEINLINE L soa_dot(const std::array<const T *, N> &a, const std::array<const T *, N> &b, std::size_t i) noexcept
+		{
+			auto result = soa_load<L>(a[0] + i) * soa_load<L>(b[0] + i);
+			for (std::size_t j = 1; j < N; ++j)
+				result = fmadd(soa_load<L>(a[j] + i), soa_load<L>(b[j] + i), result);
+			return result;
+		}
+		template<typename T, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE auto soa_streams(const soa_array<basic_vec<T, N, A>> &x) noexcept
+		{
+			std::array<const T *, N> result;
+			for (std::size_t j = 0; j < N; ++j) result[j] = x.data(j);
+			return result;
+		}
+		template<typename T, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE auto soa_streams(soa_array<basic_vec<T, N, A>> &x) noexcept
+		{
+			std::array<T *, N> result;
+			for (std::size_t j = 0; j < N; ++j) result[j] = x.data(j);
+			return result;
+		}
+	}
+
+#pragma region "soa_array aliases"
+	/** Alias for structure-of-arrays container of 2D vectors. */
+	template<typename T, typename Abi = math_abi::fixed_size<2>>
+	using soa_array2 = soa_array<vec2<T, Abi>>;
+	/** Alias for structure-of-arrays container of 3D vectors. */
+	template<typename T, typename Abi = math_abi::fixed_size<3>>
+	using soa_array3 = soa_array<vec3<T, Abi>>;
+	/** Alias for structure-of-arrays container of 4D vectors. */
+	template<typename T, typename Abi = math_abi::fixed_size<4>>
+	using soa_array4 = soa_array<vec4<T, Abi>>;
+#pragma endregion
+
+#pragma region "soa_array geometric functions"
+	/** Calculates dot products of vectors from \a a and \a b and writes them to \a out.
+	 * @note \a a and \a b must be of the same size and \a out must be at least `a.size()` elements long. */
+	template<typename T, std::size_t N, typename A>
+	inline void dot(const soa_array<basic_vec<T, N, A>> &a, const soa_array<basic_vec<T, N, A>> &b, std::span<T> out) noexcept
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(a.size() == b.size() && out.size() >= a.size());
+
+		const auto sa = detail::soa_streams(a);
+		const auto sb = detail::soa_streams(b);
+		for (std::size_t i = 0; i < a.size(); i += w)
+			detail::soa_store_n(detail::soa_dot<N, lane_t>(sa, sb, i), out.data() + i, a.size() - i);
+	}
+	/** Calculates magnitudes of vectors from \a x and writes them to \a out.
+	 * @note \a out must be at least `x.size()` elements long. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void magn(const soa_array<basic_vec<T, N, A>> &x, std::span<T> out) noexcept
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(out.size() >= x.size());
+
+		const auto sx = detail::soa_streams(x);
+		for (std::size_t i = 0; i < x.size(); i += w)
+			detail::soa_store_n(sqrt(detail::soa_dot<N, lane_t>(sx, sx, i)), out.data() + i, x.size() - i);
+	}
+
+	/** Calculates cross products of 3D vectors from \a a and \a b and writes them to \a out.
+	 * @note \a a and \a b must be of the same size. \a out is resized to `a.size()`. */
+	template<typename T, typename A>
+	inline void cross(const soa_array<basic_vec<T, 3, A>> &a, const soa_array<basic_vec<T, 3, A>> &b, soa_array<basic_vec<T, 3, A>> &out)
+	{
+		using lane_t = typename soa_array<basic_vec<T, 3, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(a.size() == b.size());
+
+		out.resize(a.size());
+		const auto sa = detail::soa_streams(a);
+		const auto sb = detail::soa_streams(b);
+		const auto so = detail::soa_streams(out);
+		for (std::size_t i = 0; i < a.size(); i += w)
+		{
+			const auto ax = detail::soa_load<lane_t>(sa[0] + i);
+			const auto ay = detail::soa_load<lane_t>(sa[1] + i);
+			const auto az = detail::soa_load<lane_t>(sa[2] + i);
+			const auto bx = detail::soa_load<lane_t>(sb[0] + i);
+			const auto by = detail::soa_load<lane_t>(sb[1] + i);
+			const auto bz = detail::soa_load<lane_t>(sb[2] + i);
+			detail::soa_store(fmsub(ay, bz, az * by), so[0] + i);
+			detail::soa_store(fmsub(az, bx, ax * bz), so[1] + i);
+			detail::soa_store(fmsub(ax, by, ay * bx), so[2] + i);
+		}
+	}
+	/** Calculates cross products of 3D vectors from \a a and \a b. */
+	template<typename T, typename A>
+	[[nodiscard]] inline soa_array<basic_vec<T, 3, A>> cross(const soa_array<basic_vec<T, 3, A>> &a, const soa_array<basic_vec<T, 3, A>> &b)
+	{
+		soa_array<basic_vec<T, 3, A>> result;
+		cross(a, b, result);
+		return result;
+	}
+
+	/** Normalizes vectors from \a x and writes them to \a out. Vectors of near-zero length are normalized to zero.
+	 * @note \a out is resized to `x.size()` and may alias \a x. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void normalize(const soa_array<basic_vec<T, N, A>> &x, soa_array<basic_vec<T, N, A>> &out)
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+
+		out.resize(x.size());
+		const auto sx = detail::soa_streams(x);
+		const auto so = detail::soa_streams(out);
+		for (std::size_t i = 0; i < x.size(); i += w)
+		{
+			const auto dp = detail::soa_dot<N, lane_t>(sx, sx, i);
+			const auto k = blend(lane_t{T{1}} / sqrt(dp), lane_t{T{0}}, dp <= lane_t{std::numeric_limits<T>::epsilon()});
+			for (std::size_t j = 0; j < N; ++j)
+				detail::soa_store(detail::soa_load<lane_t>(sx[j] + i) * k, so[j] + i);
+		}
+	}
+	/** Returns normalized copies of vectors from \a x. */
+	template<std::floating_point T, std::size_t N, typename A>
+	[[nodiscard]] inline soa_array<basic_vec<T, N, A>> normalize(const soa_array<basic_vec<T, N, A>> &x)
+	{
+		soa_array<basic_vec<T, N, A>> result;
+		normalize(x, result);
+		return result;
+	}
+
+	/** Orients normal vectors from \a n to point in the direction specified by incident vectors \a i and normal reference vectors \a r.
+	 * Equivalent to `faceforward(n[k], i[k], r[k])` for every element `k`.
+	 * @note \a n, \a i and \a r must be of the same size. \a out is resized to `n.size()` and may alias \a n. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void faceforward(const soa_array<basic_vec<T, N, A>> &n, const soa_array<basic_vec<T, N, A>> &i, const soa_array<basic_vec<T, N, A>> &r, soa_array<basic_vec<T, N, A>> &out)
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(n.size() == i.size() && n.size() == r.size());
+
+		out.resize(n.size());
+		const auto sn = detail::soa_streams(n);
+		const auto si = detail::soa_streams(i);
+		const auto sr = detail::soa_streams(r);
+		const auto so = detail::soa_streams(out);
+		for (std::size_t k = 0; k < n.size(); k += w)
+		{
+			const auto dp = detail::soa_dot<N, lane_t>(sr, si, k);
+			const auto s = blend(lane_t{T{-1}}, lane_t{T{1}}, dp < lane_t{T{0}});
+			for (std::size_t j = 0; j < N; ++j)
+				detail::soa_store(detail::soa_load<lane_t>(sn[j] + k) * s, so[j] + k);
+		}
+	}
+	/** Returns copies of normal vectors from \a n oriented in the direction specified by incident vectors \a i and normal reference vectors \a r. */
+	template<std::floating_point T, std::size_t N, typename A>
+	[[nodiscard]] inline soa_array<basic_vec<T, N, A>> faceforward(const soa_array<basic_vec<T, N, A>> &n, const soa_array<basic_vec<T, N, A>> &i, const soa_array<basic_vec<T, N, A>> &r)
+	{
+		soa_array<basic_vec<T, N, A>> result;
+		faceforward(n, i, r, result);
+		return result;
+	}
+
+	/** Calculates reflection directions for incident vectors from \a i and normal vectors from \a n and writes them to \a out.
+	 * Equivalent to `reflect(i[k], n[k])` for every element `k`.
+	 * @note \a i and \a n must be of the same size. \a out is resized to `i.size()` and may alias \a i. */
+	template<std::floating_point T, std::size_t N, typename A>
+	inline void reflect(const soa_array<basic_vec<T, N, A>> &i, const soa_array<basic_vec<T, N, A>> &n, soa_array<basic_vec<T, N, A>> &out)
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(i.size() == n.size());
+
+		out.resize(i.size());
+		const auto si = detail::soa_streams(i);
+		const auto sn = detail::soa_streams(n);
+		const auto so = detail::soa_streams(out);
+		for (std::size_t k = 0; k < i.size(); k += w)
+		{
+			const auto dp = detail::soa_dot<N, lane_t>(sn, si, k) * static_cast<T>(-2);
+			for (std::size_t j = 0; j < N; ++j)
+				detail::soa_store(fmadd(detail::soa_load<lane_t>(sn[j] + k), dp, detail::soa_load<lane_t>(si[j] + k)), so[j] + k);
+		}
+	}
+	/** Returns reflection directions for incident vectors from \a i and normal vectors from \a n. */
+	template<std::floating_point T, std::size_t N, typename A>
+	[[nodiscard]] inline soa_array<basic_vec<T, N, A>> reflect(const soa_array<basic_vec<T, N, A>> &i, const soa_array<basic_vec<T, N, A>> &n)
+	{
+		soa_array<basic_vec<T, N, A>> result;
+		reflect(i, n, result);
+		return result;
+	}
+#pragma endregion
+}
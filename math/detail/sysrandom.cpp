@@ -11,6 +11,13 @@
 
 #include "sysrandom.hpp"
 
+#include <atomic>
+#include <cstring>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <pthread.h>
+#endif
+
 #if defined(_WIN32) || defined(__CYGWIN__)
 
 #define WIN32_NO_STATUS
@@ -23,16 +30,10 @@
 
 sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept
 {
-	BCRYPT_ALG_HANDLE rng_alg;
-	if (BCryptOpenAlgorithmProvider(&rng_alg, BCRYPT_RNG_ALGORITHM, nullptr, 0) != STATUS_SUCCESS)
+	/* System-preferred RNG does not require an algorithm provider to be opened & closed per call. */
+	if (BCryptGenRandom(nullptr, static_cast<PUCHAR>(dst), static_cast<ULONG>(n), BCRYPT_USE_SYSTEM_PREFERRED_RNG) != STATUS_SUCCESS)
 		[[unlikely]] return -1;
-
-	auto result = static_cast<ssize_t>(n);
-	if (BCryptGenRandom(rng_alg, static_cast<PUCHAR>(dst), n, 0) != STATUS_SUCCESS)
-		[[unlikely]] result = -1;
-	if (BCryptCloseAlgorithmProvider(rng_alg, 0) != STATUS_SUCCESS)
-		[[unlikely]] result = -1;
-	return result;
+	return static_cast<ssize_t>(n);
 }
 
 #elif defined(__linux__) && LINUX_VERSION_CODE >= KERNEL_VERSION(3, 17, 0)
@@ -41,19 +42,29 @@ sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept { return syscal
 
 #elif defined(__linux__) || defined(__OpenBSD__)
 
-sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept { return getentropy(dst, n); }
+sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept
+{
+	/* `getentropy` is limited to 256 bytes per call and returns `0` on success. */
+	for (std::size_t i = 0; i < n; i += 256)
+		if (getentropy(static_cast<std::byte *>(dst) + i, std::min<std::size_t>(n - i, 256)) != 0)
+			[[unlikely]] return -1;
+	return static_cast<ssize_t>(n);
+}
 
 #elif defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
 
-sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept { return getentropy(dst, n); }
-
-#include <cstdio>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/random.h>
+#endif
 
 sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept
 {
-	if (auto urandom = fopen("/dev/urandom", "rb"); urandom) [[likely]]
-		return static_cast<ssize_t>(fread(dst, n, 1, urandom));
-	return -1;
+	/* `getentropy` is limited to 256 bytes per call and returns `0` on success. */
+	for (std::size_t i = 0; i < n; i += 256)
+		if (getentropy(static_cast<std::byte *>(dst) + i, std::min<std::size_t>(n - i, 256)) != 0)
+			[[unlikely]] return -1;
+	return static_cast<ssize_t>(n);
 }
 
 #else
@@ -61,3 +72,79 @@ sek::ssize_t sek::sys::random(void *dst, std::size_t n) noexcept
 sek::ssize_t sek::sys::random(void *, std::size_t) noexcept { return -1; }
 
 #endif
+
+namespace sek::sys
+{
+	namespace
+	{
+		/* Incremented in the child process after every `fork`, invalidating pools inherited from the parent. */
+		std::atomic<std::size_t> fork_generation = 0;
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+		[[maybe_unused]] const int atfork_result = pthread_atfork(nullptr, nullptr, []() { fork_generation.fetch_add(1, std::memory_order_relaxed); });
+#endif
+
+		/* Requests may be partially filled, in which case the remaining bytes are requested again. */
+		bool random_all(std::byte *dst, std::size_t n) noexcept
+		{
+			for (std::size_t i = 0; i < n;)
+			{
+				const auto result = random(dst + i, n - i);
+				if (result <= 0) [[unlikely]] return false;
+				i += static_cast<std::size_t>(result);
+			}
+			return true;
+		}
+
+		struct pool_data
+		{
+			void discard() noexcept
+			{
+				std::memset(bytes, 0, sizeof(bytes));
+				pos = sizeof(bytes);
+			}
+			bool refill() noexcept
+			{
+				if (!random_all(bytes, sizeof(bytes))) [[unlikely]] return false;
+				pos = 0;
+				return true;
+			}
+
+			std::byte bytes[entropy_pool::buffer_size];
+			std::size_t pos = entropy_pool::buffer_size;
+			std::size_t generation = 0;
+		};
+
+		[[nodiscard]] pool_data &local_pool() noexcept
+		{
+			thread_local pool_data pool;
+			if (const auto gen = fork_generation.load(std::memory_order_relaxed); pool.generation != gen) [[unlikely]]
+			{
+				pool.discard();
+				pool.generation = gen;
+			}
+			return pool;
+		}
+	}
+
+	ssize_t entropy_pool::fill(void *dst, std::size_t n) noexcept
+	{
+		if (n >= buffer_size) return random_all(static_cast<std::byte *>(dst), n) ? static_cast<ssize_t>(n) : -1;
+
+		auto &pool = local_pool();
+		for (auto *out = static_cast<std::byte *>(dst), *end = out + n; out != end;)
+		{
+			if (pool.pos == buffer_size && !pool.refill()) [[unlikely]]
+				return -1;
+
+			/* Consumed bytes are cleared so that they can not be recovered from the pool. */
+			const auto k = std::min(static_cast<std::size_t>(end - out), buffer_size - pool.pos);
+			std::memcpy(out, pool.bytes + pool.pos, k);
+			std::memset(pool.bytes + pool.pos, 0, k);
+			pool.pos += k;
+			out += k;
+		}
+		return static_cast<ssize_t>(n);
+	}
+	void entropy_pool::reset() noexcept { local_pool().discard(); }
+}
@@ -6,6 +6,9 @@
 
 #include "define.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
 #include <span>
 
 namespace sek::sys
@@ -23,4 +26,65 @@ namespace sek::sys
 
 	template<std::size_t Extent>
 	SEK_FORCEINLINE ssize_t random(std::span<std::byte, Extent> dst, std::size_t n) noexcept { return random(dst.data(), std::min(dst.size(), n)); }
+
+	/** @brief Thread-local buffered pool of OS-specific cryptographic entropy.
+	 *
+	 * Every thread keeps a buffer of `buffer_size` random bytes, which is refilled from `sys::random` with a single request
+	 * once exhausted. Consumed bytes are cleared from the buffer. Pools are discarded in the child process after `fork`,
+	 * so that the parent and the child never share entropy. */
+	class entropy_pool
+	{
+	public:
+		/** Size of the per-thread entropy buffer in bytes. */
+		constexpr static std::size_t buffer_size = 4096;
+
+	public:
+		entropy_pool() = delete;
+
+		/** Fills a buffer \a dst with \a n random bytes from the entropy pool of the calling thread.
+		 * Requests of at least `buffer_size` bytes bypass the pool and are passed directly to `sys::random` until filled.
+		 * @param dst Destination byte buffer.
+		 * @param n Amount of random bytes to generate.
+		 * @return Amount of bytes filled, or -1 if a failure occurred. */
+		template<std::size_t Extent = std::dynamic_extent>
+		static ssize_t fill(std::span<std::byte, Extent> dst, std::size_t n) noexcept { return fill(dst.data(), std::min(dst.size(), n)); }
+		/** @copydoc fill
+		 * @note This overload assumes that \a dst is at least large enough to fit \a n bytes. */
+		SEK_MATH_PUBLIC static ssize_t fill(void *dst, std::size_t n) noexcept;
+
+		/** Discards all remaining entropy of the calling thread's pool. */
+		SEK_MATH_PUBLIC static void reset() noexcept;
+	};
+
+	/** @brief Seed sequence adaptor that generates seeds from `entropy_pool`.
+	 * @tparam T Type of the generated seed values. */
+	template<std::unsigned_integral T = std::uint32_t>
+	class entropy_seed_seq
+	{
+	public:
+		using result_type = T;
+
+	public:
+		constexpr entropy_seed_seq() noexcept = default;
+
+		/** Fills range [\a first, \a last) with random seed values.
+		 * @return `true` if the range was filled successfully, `false` otherwise. */
+		template<std::random_access_iterator I>
+		bool generate(I first, I last) const noexcept
+		{
+			const auto n = static_cast<std::size_t>(std::distance(first, last));
+			if constexpr (std::contiguous_iterator<I> && sizeof(std::iter_value_t<I>) == sizeof(T))
+				return entropy_pool::fill(std::to_address(first), n * sizeof(T)) == static_cast<ssize_t>(n * sizeof(T));
+			else
+			{
+				for (; first != last; ++first)
+				{
+					T value;
+					if (entropy_pool::fill(&value, sizeof(T)) != static_cast<ssize_t>(sizeof(T))) [[unlikely]] return false;
+					*first = value;
+				}
+				return true;
+			}
+		}
+	};
 }
\ No newline at end of file
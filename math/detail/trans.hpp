@@ -12,7 +12,7 @@ namespace sek
 	namespace detail
 	{
 		template<typename T, typename MA, typename VA>
-		[[nodiscard]] inline basic_mat<T, 4, 4, MA> impl_look_at_rh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept
+		[[nodiscard]] constexpr basic_mat<T, 4, 4, MA> impl_look_at_rh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept
 		{
 			const auto f = normalize(dir - org);
 			const auto s = normalize(cross(f, up));
@@ -29,7 +29,7 @@ namespace sek
 			return result;
 		}
 		template<typename T, typename MA, typename VA>
-		[[nodiscard]] inline basic_mat<T, 4, 4, MA> impl_look_at_lh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept
+		[[nodiscard]] constexpr basic_mat<T, 4, 4, MA> impl_look_at_lh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept
 		{
 			const auto f = normalize(dir - org);
 			const auto s = normalize(cross(up, f));
@@ -51,7 +51,7 @@ namespace sek
 	 * @param v Translation vector.
 	 * @return 4x4 transform matrix with translation applied. */
 	template<typename T, typename AM, typename AV = math_abi::deduce_t<T, 3, AM>>
-	[[nodiscard]] inline basic_mat<T, 4, 4, AM> translate(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AV> &v) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 4, 4, AM> translate(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AV> &v) noexcept
 	{
 		basic_mat<T, 4, 4, AM> result;
 		auto c3 = fmadd(m[2], {v[2]}, m[3]);
@@ -67,7 +67,7 @@ namespace sek
 	 * @return 4x4 transform matrix with rotation applied.
 	 * @note Rotation axis must be normalized. */
 	template<typename T, typename AM, typename AV = math_abi::deduce_t<T, 3, AM>>
-	[[nodiscard]] inline basic_mat<T, 4, 4, AM> rotate(const basic_mat<T, 4, 4, AM> &m, T a, const basic_vec<T, 3, AV> &v) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 4, 4, AM> rotate(const basic_mat<T, 4, 4, AM> &m, T a, const basic_vec<T, 3, AV> &v) noexcept
 	{
 		const auto [a_sin, a_cos] = detail::sincos(a);
 		const auto temp = v * (T{1} - a_cos);
@@ -105,7 +105,7 @@ namespace sek
 	 * @param v Scale vector.
 	 * @return 4x4 transform matrix with scale applied. */
 	template<typename T, typename AM, typename AV = math_abi::deduce_t<T, 3, AM>>
-	[[nodiscard]] inline basic_mat<T, 4, 4, AM> scale(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AV> &v) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 4, 4, AM> scale(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AV> &v) noexcept
 	{
 		basic_mat<T, 4, 4, AM> result;
 		result[0] = m[0] * v[0];
@@ -123,7 +123,7 @@ namespace sek
 	 * @param rz Matrix projection ratio in the XY plane.
 	 * @return 4x4 transform matrix with shear applied. */
 	template<typename T, typename AM, typename AP = math_abi::deduce_t<T, 3, AM>, typename AS = math_abi::deduce_t<T, 2, AP>>
-	[[nodiscard]] inline basic_mat<T, 4, 4, AM> shear(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AP> &v, const basic_vec<T, 2, AS> &rx, const basic_vec<T, 2, AS> &ry, const basic_vec<T, 2, AS> &rz) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 4, 4, AM> shear(const basic_mat<T, 4, 4, AM> &m, const basic_vec<T, 3, AP> &v, const basic_vec<T, 2, AS> &rx, const basic_vec<T, 2, AS> &ry, const basic_vec<T, 2, AS> &rz) noexcept
 	{
 		const auto lxy = rx[0];
 		const auto lxz = rx[1];
@@ -153,7 +153,7 @@ namespace sek
 	 * @return 3x3 transform matrix with rotation applied.
 	 * @note Rotation axis must be normalized. */
 	template<typename T, typename A>
-	[[nodiscard]] inline basic_mat<T, 3, 3, A> rotate(const basic_mat<T, 3, 3, A> &m, T a, const basic_vec<T, 3, A> &v) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 3, 3, A> rotate(const basic_mat<T, 3, 3, A> &m, T a, const basic_vec<T, 3, A> &v) noexcept
 	{
 		const auto [a_sin, a_cos] = detail::sincos(a);
 		const auto temp = v * (T{1} - a_cos);
@@ -190,7 +190,7 @@ namespace sek
 	 * @param v Scale vector.
 	 * @return 3x3 transform matrix with scale applied. */
 	template<typename T, typename A>
-	[[nodiscard]] inline basic_mat<T, 3, 3, A> scale(const basic_mat<T, 3, 3, A> &m, const basic_vec<T, 3, A> &v) noexcept
+	[[nodiscard]] constexpr basic_mat<T, 3, 3, A> scale(const basic_mat<T, 3, 3, A> &m, const basic_vec<T, 3, A> &v) noexcept
 	{
 		basic_mat<T, 3, 3, A> result;
 		result[0] = m[0] * v[0];
@@ -10,10 +10,18 @@ namespace sek
 {
 	/** Calculates sine of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> sin(const basic_vec<T, N, A> &x) noexcept { return {dpm::sin(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> sin(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T v) { return detail::const_sincos(v).first; }, x);
+		return {dpm::sin(to_simd(x))};
+	}
 	/** Calculates cosine of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> cos(const basic_vec<T, N, A> &x) noexcept { return {dpm::cos(to_simd(x))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> cos(const basic_vec<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T v) { return detail::const_sincos(v).second; }, x);
+		return {dpm::cos(to_simd(x))};
+	}
 	/** Calculates tangent of elements in vector \a x. */
 	template<std::floating_point T, std::size_t N, typename A>
 	[[nodiscard]] inline basic_vec<T, N, A> tan(const basic_vec<T, N, A> &x) noexcept { return {dpm::tan(to_simd(x))}; }
@@ -31,7 +39,16 @@ namespace sek
 	[[nodiscard]] inline basic_vec<T, N, A> atan2(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b) noexcept { return {dpm::atan2(to_simd(a), to_simd(b))}; }
 	/** Calculates sine and cosine of elements in vector \a x, and assigns results to elements of \a out_sin and \a out_cos respectively. */
 	template<std::floating_point T, std::size_t N, typename A>
-	inline void sincos(const basic_vec<T, N, A> &x, basic_vec<T, N, A> &out_sin, basic_vec<T, N, A> &out_cos) noexcept { dpm::sincos(to_simd(x), to_simd(out_sin), to_simd(out_cos)); }
+	constexpr void sincos(const basic_vec<T, N, A> &x, basic_vec<T, N, A> &out_sin, basic_vec<T, N, A> &out_cos) noexcept
+	{
+		if (std::is_constant_evaluated())
+		{
+			out_sin = sin(x);
+			out_cos = cos(x);
+		}
+		else
+			dpm::sincos(to_simd(x), to_simd(out_sin), to_simd(out_cos));
+	}
 
 	/** @copydoc sin
 	 * @note Arguments and return type are promoted to `double`, or `long double` if one of the arguments is `long double`. */
@@ -19,9 +19,9 @@ namespace sek
 		inline constexpr auto is_quat_v = is_quat<std::remove_cvref_t<T>>::value;
 
 		template<typename T, typename MA, typename VA>
-		[[nodiscard]] inline basic_mat<T, 4, 4, MA> impl_look_at_rh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept;
+		[[nodiscard]] constexpr basic_mat<T, 4, 4, MA> impl_look_at_rh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept;
 		template<typename T, typename MA, typename VA>
-		[[nodiscard]] inline basic_mat<T, 4, 4, MA> impl_look_at_lh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept;
+		[[nodiscard]] constexpr basic_mat<T, 4, 4, MA> impl_look_at_lh(const basic_vec<T, 3, VA> &org, const basic_vec<T, 3, VA> &dir, const basic_vec<T, 3, VA> &up) noexcept;
 	}
 
 	/** @brief Structure used to define a mathematical matrix.
@@ -44,7 +44,7 @@ namespace sek
 
 		/** Returns identity matrix. Equivalent to `basic_mat{1}`.
 		 * @note This function is defined only for matrices where `cols() == rows()`. */
-		[[nodiscard]] static inline basic_mat identity() noexcept requires (NCols == NRows);
+		[[nodiscard]] static constexpr basic_mat identity() noexcept requires (NCols == NRows);
 
 		/** Creates a look-at transform matrix used to rotate an origin vector \a org in the look direction \a dir using the up direction \a up with default handedness.
 	 	 * @param org Origin vector to be rotated.
@@ -52,7 +52,7 @@ namespace sek
 	 	 * @param up Normalized up vector.
 		 * @note This function is defined only for 4x4 matrices. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static SEK_FORCEINLINE basic_mat look_at(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
+		[[nodiscard]] static constexpr SEK_FORCEINLINE basic_mat look_at(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
 		{
 #ifndef SEK_FORCE_LEFT_HANDED
 			return look_at_rh(org, dir, up);
@@ -66,7 +66,7 @@ namespace sek
 		 * @param up Normalized up vector.
 		 * @note This function is defined only for 4x4 matrices. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_mat look_at_rh(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
+		[[nodiscard]] static constexpr basic_mat look_at_rh(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
 		{
 			return detail::impl_look_at_rh<T, Abi, A>(org, dir, up);
 		}
@@ -76,7 +76,7 @@ namespace sek
 		 * @param up Normalized up vector.
 		 * @note This function is defined only for 4x4 matrices. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_mat look_at_lh(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
+		[[nodiscard]] static constexpr basic_mat look_at_lh(const basic_vec<T, 3, A> &org, const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept requires (NCols == NRows && NCols == 4)
 		{
 			return detail::impl_look_at_lh<T, Abi, A>(org, dir, up);
 		}
@@ -85,11 +85,11 @@ namespace sek
 		 * @param sr Subregion of the viewport to project onto.
 		 * @param vp Viewport rectangle the subregion belongs to. */
 		template<typename A = math_abi::deduce_t<T, 4, Abi>>
-		[[nodiscard]] static inline basic_mat rect_projection(const basic_bounds<T, 2, A> &sr, const basic_bounds<T, 2, A> &vp) noexcept requires (NCols == NRows && NCols == 4);
+		[[nodiscard]] static constexpr basic_mat rect_projection(const basic_bounds<T, 2, A> &sr, const basic_bounds<T, 2, A> &vp) noexcept requires (NCols == NRows && NCols == 4);
 
 	private:
-		static inline void assert_cols(std::size_t i) { if (i >= NCols) [[unlikely]] throw std::range_error("Column index out of range"); }
-		static inline void assert_rows(std::size_t i) { if (i >= NRows) [[unlikely]] throw std::range_error("Row index out of range"); }
+		static constexpr void assert_cols(std::size_t i) { if (i >= NCols) [[unlikely]] throw std::range_error("Column index out of range"); }
+		static constexpr void assert_rows(std::size_t i) { if (i >= NRows) [[unlikely]] throw std::range_error("Row index out of range"); }
 
 	public:
 		/** Initializes a null (zero) matrix. */
@@ -97,18 +97,18 @@ namespace sek
 
 		/** Initializes the matrix where elements along the main diagonal are set to `static_cast<value_type>(x)`, and the rest are zero. */
 		template<typename U>
-		basic_mat(U &&x) noexcept requires std::is_convertible_v<U, value_type> { fill_diag(std::forward<U>(x)); }
+		constexpr basic_mat(U &&x) noexcept requires std::is_convertible_v<U, value_type> { fill_diag(std::forward<U>(x)); }
 		/** Initializes columns of the matrix from \a args tuples. Remaining elements are initialized to have ones (`1`) along the main diagonal and zeros elsewhere. */
 		template<typename... Args>
-		basic_mat(Args &&...args) noexcept requires (((!detail::is_quat_v<Args> && detail::has_tuple_size<Args>) && ...)) { fill_cols(std::forward<Args>(args)...); }
+		constexpr basic_mat(Args &&...args) noexcept requires (((!detail::is_quat_v<Args> && detail::has_tuple_size<Args>) && ...)) { fill_cols(std::forward<Args>(args)...); }
 		/** Initializes the matrix from columns of another matrix. Remaining elements are initialized to have ones (`1`) along the main diagonal and zeros elsewhere. */
 		template<typename U, std::size_t OtherCols, std::size_t OtherRows, typename A>
-		basic_mat(const basic_mat<U, OtherCols, OtherRows, A> &other) noexcept requires std::is_convertible_v<U, value_type> { fill_other(other); }
+		constexpr basic_mat(const basic_mat<U, OtherCols, OtherRows, A> &other) noexcept requires std::is_convertible_v<U, value_type> { fill_other(other); }
 
 		/** Initializes the matrix from a quaternion rotation.
 		 * @note This constructor is defined only for 3x3 and 4x4 matrices. */
 		template<typename A>
-		inline basic_mat(const basic_quat<T, A> &x) noexcept requires (NCols == NRows && (NCols == 3 || NCols == 4));
+		constexpr basic_mat(const basic_quat<T, A> &x) noexcept requires (NCols == NRows && (NCols == 3 || NCols == 4));
 
 		/** Returns the number of columns in the matrix. */
 		[[nodiscard]] constexpr std::size_t cols() const noexcept { return NCols; }
@@ -119,7 +119,7 @@ namespace sek
 		 * @param i Index of the requested row.
 		 * @throw std::range_error In case \a i exceeds `rows()`.
 		 * @note Since matrices are column-major, reading a row will require element-wise access of all columns. */
-		[[nodiscard]] row_type row(std::size_t i) const
+		[[nodiscard]] constexpr row_type row(std::size_t i) const
 		{
 			assert_rows(i);
 			row_type result = {};
@@ -131,13 +131,13 @@ namespace sek
 		/** Returns reference to the `i`th column of the matrix.
 		 * @param i Index of the requested column.
 		 * @throw std::range_error In case \a i exceeds `cols()`. */
-		[[nodiscard]] col_type &col(std::size_t i)
+		[[nodiscard]] constexpr col_type &col(std::size_t i)
 		{
 			assert_cols(i);
 			return m_data[i];
 		}
 		/** @copydoc col */
-		[[nodiscard]] const col_type &col(std::size_t i) const
+		[[nodiscard]] constexpr const col_type &col(std::size_t i) const
 		{
 			assert_cols(i);
 			return m_data[i];
@@ -147,7 +147,7 @@ namespace sek
 		 * @param i Column index of the requested element.
 		 * @param j Row index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `cols()` or \a j exceeds `rows()`. */
-		[[nodiscard]] auto &at(std::size_t i, std::size_t j)
+		[[nodiscard]] constexpr auto &at(std::size_t i, std::size_t j)
 		{
 			assert_cols(i);
 			assert_rows(j);
@@ -157,7 +157,7 @@ namespace sek
 		 * @param i Column index of the requested element.
 		 * @param j Row index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `cols()` or \a j exceeds `rows()`. */
-		[[nodiscard]] value_type at(std::size_t i, std::size_t j) const
+		[[nodiscard]] constexpr value_type at(std::size_t i, std::size_t j) const
 		{
 			assert_cols(i);
 			assert_rows(j);
@@ -202,7 +202,7 @@ namespace sek
 
 	private:
 		template<std::size_t I = 0, std::size_t J = 0, typename U, typename... Args>
-		inline void fill_cols(U &&value, Args &&...args) noexcept
+		constexpr void fill_cols(U &&value, Args &&...args) noexcept
 		{
 			using V = std::remove_cvref_t<U>;
 			constexpr auto N = detail::has_tuple_size<std::tuple_element_t<0, V>> ? std::tuple_size_v<V> : 1;
@@ -226,18 +226,18 @@ namespace sek
 				fill_diag<I + N>(1);
 		}
 		template<std::size_t I = 0, std::size_t... Is, typename U>
-		inline void fill_other(std::index_sequence<Is...>, U &&value) noexcept
+		constexpr void fill_other(std::index_sequence<Is...>, U &&value) noexcept
 		{
 			using std::get;
 			(fill_cols<I + Is>(get<Is>(value)), ...);
 		}
 		template<std::size_t I = 0, typename U>
-		inline void fill_other(U &&value) noexcept
+		constexpr void fill_other(U &&value) noexcept
 		{
 			fill_other<I>(std::make_index_sequence<std::tuple_size_v<U>>{}, std::forward<U>(value));
 		}
 		template<std::size_t I = 0, typename U>
-		inline void fill_diag(U &&value) noexcept
+		constexpr void fill_diag(U &&value) noexcept
 		{
 			if constexpr (I < NCols && I < NRows)
 			{
@@ -250,7 +250,7 @@ namespace sek
 	};
 
 	template<typename T, std::size_t C, std::size_t R, typename A>
-	basic_mat<T, C, R, A> basic_mat<T, C, R, A>::identity() noexcept requires (C == R) { return basic_mat{1}; }
+	constexpr basic_mat<T, C, R, A> basic_mat<T, C, R, A>::identity() noexcept requires (C == R) { return basic_mat{1}; }
 
 	/** Gets the `I`th column of the matrix. */
 	template<std::size_t I, typename T, std::size_t NCols, std::size_t NRows, typename Abi>
@@ -260,10 +260,10 @@ namespace sek
 	[[nodiscard]] constexpr const typename basic_mat<T, NCols, NRows, Abi>::col_type &get(const basic_mat<T, NCols, NRows, Abi> &x) noexcept requires (I < NCols) { return x[I]; }
 	/** Gets the `J`th element of the `I`th column of the matrix. */
 	template<std::size_t I, std::size_t J, typename T, std::size_t NCols, std::size_t NRows, typename Abi>
-	[[nodiscard]] inline auto &get(basic_mat<T, NCols, NRows, Abi> &x) noexcept requires (I < NCols && J < NRows) { return x[I][J]; }
+	[[nodiscard]] constexpr auto &get(basic_mat<T, NCols, NRows, Abi> &x) noexcept requires (I < NCols && J < NRows) { return x[I][J]; }
 	/** @copydoc get */
 	template<std::size_t I, std::size_t J, typename T, std::size_t NCols, std::size_t NRows, typename Abi>
-	[[nodiscard]] inline auto get(const basic_mat<T, NCols, NRows, Abi> &x) noexcept requires (I < NCols && J < NRows) { return x[I][J]; }
+	[[nodiscard]] constexpr auto get(const basic_mat<T, NCols, NRows, Abi> &x) noexcept requires (I < NCols && J < NRows) { return x[I][J]; }
 
 #pragma region "basic_mat aliases"
 	/** Alias for matrix that uses implementation-defined ABI deduced from it's size, type and optional ABI hint. */
@@ -362,14 +362,14 @@ namespace sek
 
 #pragma region "basic_mat operators"
 	template<typename T, std::size_t CR, std::size_t NR, typename AM, typename AV>
-	[[nodiscard]] inline basic_vec<T, NR, math_abi::deduce_t<T, NR, AM>> operator*(const basic_mat<T, CR, NR, AM> &a, const basic_vec<T, CR, AV> &b) noexcept
+	[[nodiscard]] constexpr basic_vec<T, NR, math_abi::deduce_t<T, NR, AM>> operator*(const basic_mat<T, CR, NR, AM> &a, const basic_vec<T, CR, AV> &b) noexcept
 	{
 		basic_vec<T, NR, math_abi::deduce_t<T, NR, AM>> result = a[0] * b[0];
 		for (std::size_t i = 1; i < CR; ++i) result = fmadd(a[i], {b[i]}, result);
 		return result;
 	}
 	template<typename T, std::size_t CR, std::size_t R0, std::size_t C1, typename A0, typename A1>
-	[[nodiscard]] inline basic_mat<T, C1, R0, math_abi::deduce_t<T, R0, A0, A1>> operator*(const basic_mat<T, CR, R0, A0> &a, const basic_mat<T, C1, CR, A1> &b) noexcept
+	[[nodiscard]] constexpr basic_mat<T, C1, R0, math_abi::deduce_t<T, R0, A0, A1>> operator*(const basic_mat<T, CR, R0, A0> &a, const basic_mat<T, C1, CR, A1> &b) noexcept
 	{
 		basic_mat<T, C1, R0, math_abi::deduce_t<T, R0, A0, A1>> result;
 		for (std::size_t i = 0; i < C1; ++i)
@@ -383,7 +383,7 @@ namespace sek
 	}
 
 	template<typename T, std::size_t NCols, std::size_t NRows, typename Abi>
-	[[nodiscard]] inline bool operator==(const basic_mat<T, NCols, NRows, Abi> &a, const basic_mat<T, NCols, NRows, Abi> &b) noexcept
+	[[nodiscard]] constexpr bool operator==(const basic_mat<T, NCols, NRows, Abi> &a, const basic_mat<T, NCols, NRows, Abi> &b) noexcept
 	{
 		auto cmp = a[0] == b[0];
 		for (std::size_t i = 1; i < NCols; ++i)
@@ -391,7 +391,7 @@ namespace sek
 		return all_of(cmp);
 	}
 	template<typename T, std::size_t NCols, std::size_t NRows, typename Abi>
-	[[nodiscard]] inline bool operator!=(const basic_mat<T, NCols, NRows, Abi> &a, const basic_mat<T, NCols, NRows, Abi> &b) noexcept
+	[[nodiscard]] constexpr bool operator!=(const basic_mat<T, NCols, NRows, Abi> &a, const basic_mat<T, NCols, NRows, Abi> &b) noexcept
 	{
 		auto cmp = a[0] != b[0];
 		for (std::size_t i = 1; i < NCols; ++i)
@@ -403,7 +403,7 @@ namespace sek
 #pragma region "basic_mat algorithms"
 	/** Calculates the outer product matrix of vectors \a c and \a r. */
 	template<typename T, std::size_t NCols, std::size_t NRows, typename AC, typename AR>
-	[[nodiscard]] inline mat<T, NCols, NRows, AC> outer_prod(const basic_vec<T, NRows, AC> &c, const basic_vec<T, NCols, AR> &r) noexcept
+	[[nodiscard]] constexpr mat<T, NCols, NRows, AC> outer_prod(const basic_vec<T, NRows, AC> &c, const basic_vec<T, NCols, AR> &r) noexcept
 	{
 		mat<T, NCols, NRows, AC> result;
 		for (std::size_t i = 0; i < NCols; ++i)
@@ -413,7 +413,7 @@ namespace sek
 
 	/** Calculates the transpose matrix of \a x. */
 	template<typename T, std::size_t NRows, std::size_t NCols, typename A>
-	[[nodiscard]] inline mat<T, NRows, NCols, A> transpose(const basic_mat<T, NCols, NRows, A> &x) noexcept
+	[[nodiscard]] constexpr mat<T, NRows, NCols, A> transpose(const basic_mat<T, NCols, NRows, A> &x) noexcept
 	{
 		basic_mat<T, NRows, NCols, math_abi::deduce_t<T, NCols, A>> result;
 		for (std::size_t i = 0; i < NRows; ++i) result[i] = x.row(i);
@@ -422,13 +422,13 @@ namespace sek
 
 	/** Calculates the determinant of a 2x2 matrix \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline T determinant(const basic_mat<T, 2, 2, A> &x) noexcept
+	[[nodiscard]] constexpr T determinant(const basic_mat<T, 2, 2, A> &x) noexcept
 	{
 		return detail::fmsub(x[0][0], x[1][1], x[1][0] * x[0][1]);
 	}
 	/** Calculates the determinant of a 3x3 matrix \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline T determinant(const basic_mat<T, 3, 3, A> &x) noexcept
+	[[nodiscard]] constexpr T determinant(const basic_mat<T, 3, 3, A> &x) noexcept
 	{
 		const auto a = detail::fmsub(x[1][1], x[2][2], x[2][1] * x[1][2]);
 		const auto b = detail::fmsub(x[0][1], x[2][2], x[2][1] * x[0][2]);
@@ -437,7 +437,7 @@ namespace sek
 	}
 	/** Calculates the determinant of a 4x4 matrix \a x. */
 	template<typename T, typename A>
-	[[nodiscard]] inline T determinant(const basic_mat<T, 4, 4, A> &x) noexcept
+	[[nodiscard]] constexpr T determinant(const basic_mat<T, 4, 4, A> &x) noexcept
 	{
 		const auto f0 = detail::fmsub(x[2][2], x[3][3], x[3][2] * x[2][3]);
 		const auto f1 = detail::fmsub(x[2][1], x[3][3], x[3][1] * x[2][3]);
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <stdexcept>
+#include <functional>
+#include <algorithm>
 #include <ranges>
 
 #include "shuffle.hpp"
@@ -37,6 +39,25 @@ namespace sek
 
 		template<typename T, std::size_t N, typename... Ts>
 		concept compatible_args = std::conjunction_v<is_compatible_arg<T, std::remove_cvref_t<Ts>>...> && (0 + ... + arg_extent_v<Ts>) == N;
+
+		/* SIMD operations are not usable in constant expressions, so during constant evaluation vector operations
+		 * fall back to element-wise scalar loops. This only requires element access of the underlying storage. */
+		template<typename R, typename F, typename... Vs>
+		[[nodiscard]] constexpr R const_apply(F &&f, const Vs &...vs) noexcept
+		{
+			R result = {};
+			for (std::size_t i = 0; i < result.size(); ++i)
+				result[i] = static_cast<typename R::value_type>(f(vs[i]...));
+			return result;
+		}
+		template<typename V, typename F>
+		[[nodiscard]] constexpr auto const_reduce(const V &x, F &&f) noexcept
+		{
+			typename V::value_type result = x[0];
+			for (std::size_t i = 1; i < x.size(); ++i)
+				result = static_cast<typename V::value_type>(f(result, x[i]));
+			return result;
+		}
 	}
 
 	/** @brief Structure used to define a boolean mask for a mathematical vector.
@@ -69,14 +90,14 @@ namespace sek
 
 		/** Initializes elements of the vector mask to `static_cast<value_type>(x)`. */
 		template<typename U>
-		basic_vec_mask(U &&x) noexcept requires std::is_convertible_v<U, value_type> : m_data(std::forward<U>(x)) {}
+		constexpr basic_vec_mask(U &&x) noexcept requires std::is_convertible_v<U, value_type> : m_data(std::forward<U>(x)) {}
 		/** @brief Initializes vector mask from \a vals.
 		 *
 		 * Given argument `arg` from \a args of type `U`, if `U` is a tuple-like type, initializes `std::tuple_size_v<std::remove_cvref_t<U>>`
 		 * elements of the vector mask as `static_cast<value_type>(get<I>(arg))`, where `I` is the index of the corresponding element in `U`.
 		 * Otherwise, if `U` is not tuple-like, initializes the `N`th element of the vector mask as `static_cast<value_type>(arg)`. */
 		template<typename... Args>
-		basic_vec_mask(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...> { fill_vals(std::forward<Args>(args)...); }
+		constexpr basic_vec_mask(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...> { fill_vals(std::forward<Args>(args)...); }
 
 		/** Initializes vector mask from a range of elements pointed to by iterators \a first and \a last.
 		 * @throw std::range_error If size of the range is less than `size()`. */
@@ -107,9 +128,9 @@ namespace sek
 		basic_vec_mask(const R &data) requires std::is_convertible_v<std::ranges::range_value_t<R>, value_type> : basic_vec_mask(std::ranges::begin(data), std::ranges::end(data)) {}
 
 		template<typename U, typename OtherAbi>
-		basic_vec_mask(const dpm::simd_mask<U, OtherAbi> &data) noexcept : m_data(data) {}
+		constexpr basic_vec_mask(const dpm::simd_mask<U, OtherAbi> &data) noexcept : m_data(data) {}
 		template<typename U, std::size_t M, typename OtherAbi>
-		basic_vec_mask(const basic_vec_mask<U, M, OtherAbi> &other) noexcept { fill_other(other); }
+		constexpr basic_vec_mask(const basic_vec_mask<U, M, OtherAbi> &other) noexcept { fill_other(other); }
 
 		/** @brief Fills vector mask from \a args.
 		 *
@@ -117,7 +138,7 @@ namespace sek
 		 * elements of the vector mask from `static_cast<value_type>(get<I>(arg))`, where `I` is the index of the corresponding element in `U`.
 		 * Otherwise, if `U` is not tuple-like, assigns the `N`th element of the vector mask from `static_cast<value_type>(arg)`. */
 		template<typename... Args>
-		basic_vec_mask &fill(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...>
+		constexpr basic_vec_mask &fill(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...>
 		{
 			fill_vals(std::forward<Args>(args)...);
 			return *this;
@@ -127,12 +148,12 @@ namespace sek
 		[[nodiscard]] constexpr std::size_t size() const noexcept { return N; }
 
 		/** Returns `true` if all elements of the vector mask evaluate to `true`. */
-		[[nodiscard]] inline operator bool() const noexcept;
+		[[nodiscard]] constexpr operator bool() const noexcept;
 
 		/** Returns reference to the `i`th element of the vector mask.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `size()`. */
-		[[nodiscard]] auto &at(std::size_t i)
+		[[nodiscard]] constexpr auto &at(std::size_t i)
 		{
 			assert_idx(i);
 			return m_data[i];
@@ -140,7 +161,7 @@ namespace sek
 		/** Returns copy of the `i`th element of the vector mask.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `size()`. */
-		[[nodiscard]] value_type at(std::size_t i) const
+		[[nodiscard]] constexpr value_type at(std::size_t i) const
 		{
 			assert_idx(i);
 			return m_data[i];
@@ -148,32 +169,34 @@ namespace sek
 
 		/** Returns reference to the `i`th element of the vector mask.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] auto &operator[](std::size_t i) noexcept { return m_data[i]; }
+		[[nodiscard]] constexpr auto &operator[](std::size_t i) noexcept { return m_data[i]; }
 		/** Returns copy of the `i`th element of the vector mask.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] value_type operator[](std::size_t i) const noexcept { return m_data[i]; }
+		[[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept { return m_data[i]; }
 
 		SEK_MAKE_VEC_GETTERS(basic_vec_mask, value_type, x, y, z, w)
 		SEK_MAKE_VEC_GETTERS(basic_vec_mask, value_type, r, g, b, a)
 
 	private:
 		template<typename U, std::size_t M, typename OtherAbi>
-		SEK_FORCEINLINE void fill_other(const basic_vec_mask<U, M, OtherAbi> &other) noexcept
+		constexpr SEK_FORCEINLINE void fill_other(const basic_vec_mask<U, M, OtherAbi> &other) noexcept
 		{
 			if constexpr (M != N)
-				fill_tuple(std::make_index_sequence<M>{}, other);
+				fill_tuple<0>(std::make_index_sequence<std::min(M, N)>{}, other);
+			else if (std::is_constant_evaluated())
+				for (std::size_t i = 0; i < N; ++i) m_data[i] = static_cast<value_type>(other[i]);
 			else
 				m_data = to_simd(other);
 		}
 		template<std::size_t J, std::size_t I, std::size_t... Is, typename U>
-		SEK_FORCEINLINE void fill_tuple(std::index_sequence<I, Is...>, U &&x) noexcept
+		constexpr SEK_FORCEINLINE void fill_tuple(std::index_sequence<I, Is...>, U &&x) noexcept
 		{
 			using std::get;
 			operator[](J) = static_cast<value_type>(get<I>(x));
 			if constexpr (sizeof...(Is) != 0) fill_tuple<J + 1>(std::index_sequence<Is...>{}, std::forward<U>(x));
 		}
 		template<std::size_t I = 0, typename U, typename... Us>
-		SEK_FORCEINLINE void fill_vals(U &&x, Us &&...args) noexcept
+		constexpr SEK_FORCEINLINE void fill_vals(U &&x, Us &&...args) noexcept
 		{
 			if constexpr (I < N)
 			{
@@ -197,17 +220,18 @@ namespace sek
 
 	/** Shuffles elements of the vector mask according to the indices specified by `Is`. */
 	template<std::size_t... Is, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, sizeof...(Is), math_abi::deduce_t<T, sizeof...(Is), Abi>> shuffle(const basic_vec_mask<T, N, Abi> &x) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, sizeof...(Is), math_abi::deduce_t<T, sizeof...(Is), Abi>> shuffle(const basic_vec_mask<T, N, Abi> &x) noexcept
 	{
+		if (std::is_constant_evaluated()) return {x[Is]...};
 		return {dpm::shuffle<Is...>(to_simd(x))};
 	}
 
 	/** Gets the `I`th element of the vector mask. */
 	template<std::size_t I, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline auto &get(basic_vec_mask<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
+	[[nodiscard]] constexpr auto &get(basic_vec_mask<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
 	/** @copydoc get */
 	template<std::size_t I, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline auto get(const basic_vec_mask<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
+	[[nodiscard]] constexpr auto get(const basic_vec_mask<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
 
 #pragma region "basic_vec_mask aliases"
 	/** Alias for vector mask that uses implementation-defined ABI deduced from it's size, type and optional ABI hint. */
@@ -257,49 +281,82 @@ namespace sek
 	/** Alias for packed-ABI vector mask of 4 elements. */
 	template<typename T>
 	using packed_vec4_mask = packed_vec_mask<T, 4>;
+
+	/** Alias for vector mask that uses implementation-defined native ABI. Size of the mask is the native SIMD width of `T`. */
+	template<typename T>
+	using native_vec_mask = basic_vec_mask<T, math_abi::abi_tag_size_v<T, math_abi::native<T>>, math_abi::native<T>>;
 #pragma endregion
 
 #pragma region "basic_vec_mask operators"
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator!(const basic_vec_mask<T, N, Abi> &x) noexcept { return {!to_simd(x)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator!(const basic_vec_mask<T, N, Abi> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::logical_not<>{}, x);
+		return {!to_simd(x)};
+	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator&(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept { return {to_simd(a) & to_simd(b)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator&(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::bit_and<>{}, a, b);
+		return {to_simd(a) & to_simd(b)};
+	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator|(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept { return {to_simd(a) | to_simd(b)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator|(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::bit_or<>{}, a, b);
+		return {to_simd(a) | to_simd(b)};
+	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator^(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept { return {to_simd(a) ^ to_simd(b)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator^(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::bit_xor<>{}, a, b);
+		return {to_simd(a) ^ to_simd(b)};
+	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec_mask<T, N, Abi> &operator&=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	constexpr basic_vec_mask<T, N, Abi> &operator&=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return a = a & b;
 		to_simd(a) &= to_simd(b);
 		return a;
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec_mask<T, N, Abi> &operator|=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	constexpr basic_vec_mask<T, N, Abi> &operator|=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return a = a | b;
 		to_simd(a) |= to_simd(b);
 		return a;
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec_mask<T, N, Abi> &operator^=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	constexpr basic_vec_mask<T, N, Abi> &operator^=(basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return a = a ^ b;
 		to_simd(a) ^= to_simd(b);
 		return a;
 	}
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator&&(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept { return {to_simd(a) && to_simd(b)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator&&(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::logical_and<>{}, a, b);
+		return {to_simd(a) && to_simd(b)};
+	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator||(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept { return {to_simd(a) || to_simd(b)}; }
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator||(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::logical_or<>{}, a, b);
+		return {to_simd(a) || to_simd(b)};
+	}
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator==(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator==(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::equal_to<>{}, a, b);
 		return {to_simd(a) == to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator!=(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator!=(const basic_vec_mask<T, N, Abi> &a, const basic_vec_mask<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::not_equal_to<>{}, a, b);
 		return {to_simd(a) != to_simd(b)};
 	}
 #pragma endregion
@@ -307,13 +364,25 @@ namespace sek
 #pragma region "basic_vec_mask reductions"
 	/** Returns `true` if all of the elements of the vector mask are `true`. Otherwise returns `false`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline bool all_of(const basic_vec_mask<T, N, A> &x) noexcept { return all_of(to_simd(x)); }
+	[[nodiscard]] constexpr bool all_of(const basic_vec_mask<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, std::logical_and<>{});
+		return all_of(to_simd(x));
+	}
 	/** Returns `true` if at least one of the elements of the vector mask are `true`. Otherwise returns `false`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline bool any_of(const basic_vec_mask<T, N, A> &x) noexcept { return any_of(to_simd(x)); }
+	[[nodiscard]] constexpr bool any_of(const basic_vec_mask<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, std::logical_or<>{});
+		return any_of(to_simd(x));
+	}
 	/** Returns `true` if at none of the elements of the vector mask is `true`. Otherwise returns `false`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline bool none_of(const basic_vec_mask<T, N, A> &x) noexcept { return none_of(to_simd(x)); }
+	[[nodiscard]] constexpr bool none_of(const basic_vec_mask<T, N, A> &x) noexcept
+	{
+		if (std::is_constant_evaluated()) return !any_of(x);
+		return none_of(to_simd(x));
+	}
 	/** Returns `true` if at least one of the elements of the vector mask is `true` and at least one is `false`. Otherwise returns `false`. */
 	template<typename T, std::size_t N, typename A>
 	[[nodiscard]] inline bool some_of(const basic_vec_mask<T, N, A> &x) noexcept { return some_of(to_simd(x)); }
@@ -330,7 +399,7 @@ namespace sek
 #pragma endregion
 
 	template<typename T, std::size_t N, typename A>
-	basic_vec_mask<T, N, A>::operator bool() const noexcept { return all_of(*this); }
+	constexpr basic_vec_mask<T, N, A>::operator bool() const noexcept { return all_of(*this); }
 
 	/** @brief Structure used to define a mathematical vector.
 	 * @tparam T Value type stored by the vector.
@@ -355,41 +424,41 @@ namespace sek
 		using mask_type = basic_vec_mask<T, N, Abi>;
 
 		/** Returns a vector of minimum values of `value_type`. */
-		[[nodiscard]] static inline basic_vec min() noexcept;
+		[[nodiscard]] static constexpr basic_vec min() noexcept;
 		/** Returns a vector of maximum values of `value_type`. */
-		[[nodiscard]] static inline basic_vec max() noexcept;
+		[[nodiscard]] static constexpr basic_vec max() noexcept;
 
 		/** Returns an `up` unit vector. Equivalent to `basic_vec{0, 1}`.
 		 * @note This overload is defined only for 2D vectors. */
-		[[nodiscard]] static inline basic_vec up() noexcept requires (std::is_signed_v<T> && N == 2);
+		[[nodiscard]] static constexpr basic_vec up() noexcept requires (std::is_signed_v<T> && N == 2);
 		/** Returns a `down` unit vector. Equivalent to `basic_vec{0, -1}`.
 		 * @note This overload is defined only for 2D vectors. */
-		[[nodiscard]] static inline basic_vec down() noexcept requires (std::is_signed_v<T> && N == 2);
+		[[nodiscard]] static constexpr basic_vec down() noexcept requires (std::is_signed_v<T> && N == 2);
 		/** Returns a `left` unit vector. Equivalent to `basic_vec{-1, 0}`.
 		 * @note This overload is defined only for 2D vectors. */
-		[[nodiscard]] static inline basic_vec left() noexcept requires (std::is_signed_v<T> && N == 2);
+		[[nodiscard]] static constexpr basic_vec left() noexcept requires (std::is_signed_v<T> && N == 2);
 		/** Returns a `right` unit vector. Equivalent to `basic_vec{1, 0}`.
 		 * @note This overload is defined only for 2D vectors. */
-		[[nodiscard]] static inline basic_vec right() noexcept requires (std::is_signed_v<T> && N == 2);
+		[[nodiscard]] static constexpr basic_vec right() noexcept requires (std::is_signed_v<T> && N == 2);
 
 		/** Returns an `up` unit vector. Equivalent to `basic_vec{0, 1, 0}`.
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec up() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec up() noexcept requires (std::is_signed_v<T> && N == 3);
 		/** Returns a `down` unit vector. Equivalent to `basic_vec{0, -1, 0}`.
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec down() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec down() noexcept requires (std::is_signed_v<T> && N == 3);
 		/** Returns a `left` unit vector. Equivalent to `basic_vec{-1, 0, 0}`.
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec left() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec left() noexcept requires (std::is_signed_v<T> && N == 3);
 		/** Returns a `right` unit vector. Equivalent to `basic_vec{1, 0, 0}`.
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec right() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec right() noexcept requires (std::is_signed_v<T> && N == 3);
 		/** Returns a `forward` unit vector. Equivalent to `basic_vec{0, 0, -1}` (or `basic_vec{0, 0, 1}` if using left-handed coordinates).
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec forward() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec forward() noexcept requires (std::is_signed_v<T> && N == 3);
 		/** Returns a `backward` unit vector. Equivalent to `basic_vec{0, 0, 1}` (or `basic_vec{0, 0, -1}` if using left-handed coordinates).
 		 * @note This overload is defined only for 3D vectors. */
-		[[nodiscard]] static inline basic_vec backward() noexcept requires (std::is_signed_v<T> && N == 3);
+		[[nodiscard]] static constexpr basic_vec backward() noexcept requires (std::is_signed_v<T> && N == 3);
 
 	private:
 		static inline void assert_idx(std::size_t i) { if (i >= N) [[unlikely]] throw std::range_error("Element index out of range"); }
@@ -399,14 +468,14 @@ namespace sek
 
 		/** Initializes elements of the vector to `static_cast<value_type>(x)`. */
 		template<typename U>
-		basic_vec(U &&x) noexcept requires std::is_convertible_v<U, value_type> : m_data(std::forward<U>(x)) {}
+		constexpr basic_vec(U &&x) noexcept requires std::is_convertible_v<U, value_type> : m_data(std::forward<U>(x)) {}
 		/** @brief Initializes vector from \a vals.
 		 *
 		 * Given argument `arg` from \a args of type `U`, if `U` is a tuple-like type, initializes `std::tuple_size_v<std::remove_cvref_t<U>>`
 		 * elements of the vector as `static_cast<value_type>(get<I>(arg))`, where `I` is the index of the corresponding element in `U`.
 		 * Otherwise, if `U` is not tuple-like, initializes the `N`th element of the vector as `static_cast<value_type>(arg)`. */
 		template<typename... Args>
-		basic_vec(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...> { fill_vals(std::forward<Args>(args)...); }
+		constexpr basic_vec(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...> { fill_vals(std::forward<Args>(args)...); }
 
 		/** Initializes vector from a range of elements pointed to by iterators \a first and \a last.
 		 * @throw std::range_error If size of the range is less than `size()`. */
@@ -437,9 +506,9 @@ namespace sek
 		basic_vec(const R &data) requires std::is_convertible_v<std::ranges::range_value_t<R>, value_type> : basic_vec(std::ranges::begin(data), std::ranges::end(data)) {}
 
 		template<typename U, typename OtherAbi>
-		basic_vec(const dpm::simd<U, OtherAbi> &data) noexcept : m_data(data) {}
+		constexpr basic_vec(const dpm::simd<U, OtherAbi> &data) noexcept : m_data(data) {}
 		template<typename U, std::size_t M, typename OtherAbi>
-		basic_vec(const basic_vec<U, M, OtherAbi> &other) noexcept { fill_other(other); }
+		constexpr basic_vec(const basic_vec<U, M, OtherAbi> &other) noexcept { fill_other(other); }
 
 		/** @brief Fills vector from \a args.
 		 *
@@ -447,7 +516,7 @@ namespace sek
 		 * elements of the vector from `static_cast<value_type>(get<I>(arg))`, where `I` is the index of the corresponding element in `U`.
 		 * Otherwise, if `U` is not tuple-like, assigns the `N`th element of the vector from `static_cast<value_type>(arg)`. */
 		template<typename... Args>
-		basic_vec &fill(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...>
+		constexpr basic_vec &fill(Args &&...args) noexcept requires detail::compatible_args<value_type, N, Args...>
 		{
 			fill_vals(std::forward<Args>(args)...);
 			return *this;
@@ -459,7 +528,7 @@ namespace sek
 		/** Returns reference to the `i`th element of the vector.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `size()`. */
-		[[nodiscard]] auto &at(std::size_t i)
+		[[nodiscard]] constexpr auto &at(std::size_t i)
 		{
 			assert_idx(i);
 			return m_data[i];
@@ -467,7 +536,7 @@ namespace sek
 		/** Returns copy of the `i`th element of the vector.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `size()`. */
-		[[nodiscard]] value_type at(std::size_t i) const
+		[[nodiscard]] constexpr value_type at(std::size_t i) const
 		{
 			assert_idx(i);
 			return m_data[i];
@@ -475,32 +544,34 @@ namespace sek
 
 		/** Returns reference to the `i`th element of the vector.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] auto &operator[](std::size_t i) noexcept { return m_data[i]; }
+		[[nodiscard]] constexpr auto &operator[](std::size_t i) noexcept { return m_data[i]; }
 		/** Returns copy of the `i`th element of the vector.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] value_type operator[](std::size_t i) const noexcept { return m_data[i]; }
+		[[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept { return m_data[i]; }
 
 		SEK_MAKE_VEC_GETTERS(basic_vec, value_type, x, y, z, w)
 		SEK_MAKE_VEC_GETTERS(basic_vec, value_type, r, g, b, a)
 
 	private:
 		template<typename U, std::size_t M, typename OtherAbi>
-		SEK_FORCEINLINE void fill_other(const basic_vec<U, M, OtherAbi> &other) noexcept
+		constexpr SEK_FORCEINLINE void fill_other(const basic_vec<U, M, OtherAbi> &other) noexcept
 		{
 			if constexpr (M != N)
-				fill_tuple(std::make_index_sequence<M>{}, other);
+				fill_tuple<0>(std::make_index_sequence<std::min(M, N)>{}, other);
+			else if (std::is_constant_evaluated())
+				for (std::size_t i = 0; i < N; ++i) m_data[i] = static_cast<value_type>(other[i]);
 			else
 				m_data = to_simd(other);
 		}
 		template<std::size_t J, std::size_t I, std::size_t... Is, typename U>
-		SEK_FORCEINLINE void fill_tuple(std::index_sequence<I, Is...>, U &&x) noexcept
+		constexpr SEK_FORCEINLINE void fill_tuple(std::index_sequence<I, Is...>, U &&x) noexcept
 		{
 			using std::get;
 			operator[](J) = static_cast<value_type>(get<I>(x));
 			if constexpr (sizeof...(Is) != 0) fill_tuple<J + 1>(std::index_sequence<Is...>{}, std::forward<U>(x));
 		}
 		template<std::size_t I = 0, typename U, typename... Us>
-		SEK_FORCEINLINE void fill_vals(U &&x, Us &&...args) noexcept
+		constexpr SEK_FORCEINLINE void fill_vals(U &&x, Us &&...args) noexcept
 		{
 			if constexpr (I < N)
 			{
@@ -516,38 +587,38 @@ namespace sek
 	};
 
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::min() noexcept { return {std::numeric_limits<T>::min()}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::min() noexcept { return {std::numeric_limits<T>::min()}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::max() noexcept { return {std::numeric_limits<T>::max()}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::max() noexcept { return {std::numeric_limits<T>::max()}; }
 
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::up() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{0, 1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::up() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{0, 1}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::down() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{0, -1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::down() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{0, -1}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::left() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{-1, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::left() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{-1, 0}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::right() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{1, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::right() noexcept requires (std::is_signed_v<T> && N == 2) { return basic_vec<T, N, A>{1, 0}; }
 
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::up() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 1, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::up() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 1, 0}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::down() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, -1, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::down() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, -1, 0}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::left() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{-1, 0, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::left() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{-1, 0, 0}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::right() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{1, 0, 0}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::right() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{1, 0, 0}; }
 
 #ifndef SEK_FORCE_LEFT_HANDED
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::forward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, -1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::forward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, -1}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::backward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, 1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::backward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, 1}; }
 #else
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::forward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, 1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::forward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, 1}; }
 	template<typename T, std::size_t N, typename A>
-	basic_vec<T, N, A> basic_vec<T, N, A>::backward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, -1}; }
+	constexpr basic_vec<T, N, A> basic_vec<T, N, A>::backward() noexcept requires (std::is_signed_v<T> && N == 3) { return basic_vec<T, N, A>{0, 0, -1}; }
 #endif
 
 	/** Returns reference to the underlying `dpm::simd` object of the vector. */
@@ -559,17 +630,18 @@ namespace sek
 
 	/** Shuffles elements of the vector according to the indices specified by `Is`. */
 	template<std::size_t... Is, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, sizeof...(Is), math_abi::deduce_t<T, sizeof...(Is), Abi>> shuffle(const basic_vec<T, N, Abi> &x) noexcept
+	[[nodiscard]] constexpr basic_vec<T, sizeof...(Is), math_abi::deduce_t<T, sizeof...(Is), Abi>> shuffle(const basic_vec<T, N, Abi> &x) noexcept
 	{
+		if (std::is_constant_evaluated()) return {x[Is]...};
 		return {dpm::shuffle<Is...>(to_simd(x))};
 	}
 
 	/** Gets the `I`th element of the vector. */
 	template<std::size_t I, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline auto &get(basic_vec<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
+	[[nodiscard]] constexpr auto &get(basic_vec<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
 	/** @copydoc get */
 	template<std::size_t I, typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline auto get(const basic_vec<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
+	[[nodiscard]] constexpr auto get(const basic_vec<T, N, Abi> &x) noexcept requires (I < N) { return x[I]; }
 
 #pragma region "basic_vec aliases"
 	/** Alias for vector that uses implementation-defined ABI deduced from it's size, type and optional ABI hint. */
@@ -619,13 +691,21 @@ namespace sek
 	/** Alias for packed-ABI vector of 4 elements. */
 	template<typename T>
 	using packed_vec4 = packed_vec<T, 4>;
+
+	/** Alias for vector that uses implementation-defined native ABI. Size of the vector is the native SIMD width of `T`. */
+	template<typename T>
+	using native_vec = basic_vec<T, math_abi::abi_tag_size_v<T, math_abi::native<T>>, math_abi::native<T>>;
 #pragma endregion
 
 #pragma region "basic_vec operators"
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &x) noexcept requires (requires { +to_simd(x); }) { return {+to_simd(x)}; }
+	constexpr basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &x) noexcept requires (requires { +to_simd(x); }) { return x; }
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &x) noexcept requires (requires { -to_simd(x); }) { return {-to_simd(x)}; }
+	constexpr basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &x) noexcept requires (requires { -to_simd(x); })
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, Abi>>(std::negate<>{}, x);
+		return {-to_simd(x)};
+	}
 
 	template<typename T, std::size_t N, typename Abi>
 	inline basic_vec<T, N, Abi> operator++(basic_vec<T, N, Abi> &x, int) noexcept requires (requires { to_simd(x)++; }) { return {to_simd(x)++}; }
@@ -637,45 +717,51 @@ namespace sek
 	inline basic_vec<T, N, Abi> &operator--(basic_vec<T, N, Abi> &x) noexcept requires (requires { --to_simd(x); }) { return --to_simd(x); }
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) + to_simd(b); })
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) + to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, Abi>>(std::plus<>{}, a, b);
 		return {to_simd(a) + to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) - to_simd(b); })
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) - to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, Abi>>(std::minus<>{}, a, b);
 		return {to_simd(a) - to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator+=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) += to_simd(b); })
+	constexpr basic_vec<T, N, Abi> &operator+=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) += to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return a = a + b;
 		to_simd(a) += to_simd(b);
 		return a;
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator-=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) -= to_simd(b); })
+	constexpr basic_vec<T, N, Abi> &operator-=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) -= to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return a = a - b;
 		to_simd(a) -= to_simd(b);
 		return a;
 	}
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a + basic_vec<T, N, Abi>{b}; }) { return a + basic_vec<T, N, Abi>{b}; }
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator+(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a + basic_vec<T, N, Abi>{b}; }) { return a + basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a - basic_vec<T, N, Abi>{b}; }) { return a - basic_vec<T, N, Abi>{b}; }
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator-(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a - basic_vec<T, N, Abi>{b}; }) { return a - basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator+=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a += basic_vec<T, N, Abi>{b}; }) { return a += basic_vec<T, N, Abi>{b}; }
+	constexpr basic_vec<T, N, Abi> &operator+=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a += basic_vec<T, N, Abi>{b}; }) { return a += basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator-=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a -= basic_vec<T, N, Abi>{b}; }) { return a -= basic_vec<T, N, Abi>{b}; }
+	constexpr basic_vec<T, N, Abi> &operator-=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a -= basic_vec<T, N, Abi>{b}; }) { return a -= basic_vec<T, N, Abi>{b}; }
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator*(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) * to_simd(b); })
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator*(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) * to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, Abi>>(std::multiplies<>{}, a, b);
 		return {to_simd(a) * to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator/(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) / to_simd(b); })
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator/(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) / to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, Abi>>(std::divides<>{}, a, b);
 		return {to_simd(a) / to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
@@ -684,14 +770,16 @@ namespace sek
 		return {to_simd(a) % to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator*=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) *= to_simd(b); })
+	constexpr basic_vec<T, N, Abi> &operator*=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) *= to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return a = a * b;
 		to_simd(a) *= to_simd(b);
 		return a;
 	}
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator/=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) /= to_simd(b); })
+	constexpr basic_vec<T, N, Abi> &operator/=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) /= to_simd(b); })
 	{
+		if (std::is_constant_evaluated()) return a = a / b;
 		to_simd(a) /= to_simd(b);
 		return a;
 	}
@@ -703,15 +791,15 @@ namespace sek
 	}
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator*(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a * basic_vec<T, N, Abi>{b}; }) { return a * basic_vec<T, N, Abi>{b}; }
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator*(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a * basic_vec<T, N, Abi>{b}; }) { return a * basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec<T, N, Abi> operator/(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a / basic_vec<T, N, Abi>{b}; }) { return a / basic_vec<T, N, Abi>{b}; }
+	[[nodiscard]] constexpr basic_vec<T, N, Abi> operator/(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a / basic_vec<T, N, Abi>{b}; }) { return a / basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
 	[[nodiscard]] inline basic_vec<T, N, Abi> operator%(const basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a % basic_vec<T, N, Abi>{b}; }) { return a % basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator*=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a *= basic_vec<T, N, Abi>{b}; }) { return a *= basic_vec<T, N, Abi>{b}; }
+	constexpr basic_vec<T, N, Abi> &operator*=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a *= basic_vec<T, N, Abi>{b}; }) { return a *= basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
-	inline basic_vec<T, N, Abi> &operator/=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a /= basic_vec<T, N, Abi>{b}; }) { return a /= basic_vec<T, N, Abi>{b}; }
+	constexpr basic_vec<T, N, Abi> &operator/=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a /= basic_vec<T, N, Abi>{b}; }) { return a /= basic_vec<T, N, Abi>{b}; }
 	template<typename T, std::size_t N, typename Abi>
 	inline basic_vec<T, N, Abi> &operator%=(basic_vec<T, N, Abi> &a, T b) noexcept requires (requires { a %= basic_vec<T, N, Abi>{b}; }) { return a %= basic_vec<T, N, Abi>{b}; }
 
@@ -761,6 +849,42 @@ namespace sek
 		return a;
 	}
 
+	template<typename T, std::size_t N, typename Abi>
+	[[nodiscard]] inline basic_vec<T, N, Abi> operator~(const basic_vec<T, N, Abi> &x) noexcept requires (requires { ~to_simd(x); }) { return {~to_simd(x)}; }
+	template<typename T, std::size_t N, typename Abi>
+	[[nodiscard]] inline basic_vec<T, N, Abi> operator&(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) & to_simd(b); })
+	{
+		return {to_simd(a) & to_simd(b)};
+	}
+	template<typename T, std::size_t N, typename Abi>
+	[[nodiscard]] inline basic_vec<T, N, Abi> operator|(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) | to_simd(b); })
+	{
+		return {to_simd(a) | to_simd(b)};
+	}
+	template<typename T, std::size_t N, typename Abi>
+	[[nodiscard]] inline basic_vec<T, N, Abi> operator^(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) ^ to_simd(b); })
+	{
+		return {to_simd(a) ^ to_simd(b)};
+	}
+	template<typename T, std::size_t N, typename Abi>
+	inline basic_vec<T, N, Abi> &operator&=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) &= to_simd(b); })
+	{
+		to_simd(a) &= to_simd(b);
+		return a;
+	}
+	template<typename T, std::size_t N, typename Abi>
+	inline basic_vec<T, N, Abi> &operator|=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) |= to_simd(b); })
+	{
+		to_simd(a) |= to_simd(b);
+		return a;
+	}
+	template<typename T, std::size_t N, typename Abi>
+	inline basic_vec<T, N, Abi> &operator^=(basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept requires (requires { to_simd(a) ^= to_simd(b); })
+	{
+		to_simd(a) ^= to_simd(b);
+		return a;
+	}
+
 	/** Logically shifts elements of vector \a x left by a constant number of bits `N`. */
 	template<std::size_t N, std::integral T, std::size_t M, typename A>
 	[[nodiscard]] inline basic_vec<T, M, A> lsl(const basic_vec<T, M, A> &x) noexcept requires (N < std::numeric_limits<T>::digits) { return {dpm::lsl<N>(to_simd(x))}; }
@@ -778,33 +902,39 @@ namespace sek
 	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator!(const basic_vec<T, N, Abi> &x) noexcept { return {!to_simd(x)}; }
 
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator==(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator==(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::equal_to<>{}, a, b);
 		return {to_simd(a) == to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator!=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator!=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::not_equal_to<>{}, a, b);
 		return {to_simd(a) != to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator<=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator<=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::less_equal<>{}, a, b);
 		return {to_simd(a) <= to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator>=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator>=(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::greater_equal<>{}, a, b);
 		return {to_simd(a) >= to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator<(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator<(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::less<>{}, a, b);
 		return {to_simd(a) < to_simd(b)};
 	}
 	template<typename T, std::size_t N, typename Abi>
-	[[nodiscard]] inline basic_vec_mask<T, N, Abi> operator>(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_vec_mask<T, N, Abi> operator>(const basic_vec<T, N, Abi> &a, const basic_vec<T, N, Abi> &b) noexcept
 	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec_mask<T, N, Abi>>(std::greater<>{}, a, b);
 		return {to_simd(a) > to_simd(b)};
 	}
 #pragma endregion
@@ -812,14 +942,26 @@ namespace sek
 #pragma region "basic_vec reductions"
 	/** Calculates a reduction of all elements from \a x using \a binary_op. */
 	template<typename T, std::size_t N, typename A, typename Op = std::plus<>>
-	[[nodiscard]] inline T reduce(const basic_vec<T, N, A> &x, Op binary_op = {}) { return reduce(to_simd(x), std::move(binary_op)); }
+	[[nodiscard]] constexpr T reduce(const basic_vec<T, N, A> &x, Op binary_op = {})
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, binary_op);
+		return reduce(to_simd(x), std::move(binary_op));
+	}
 
 	/** Finds the horizontal sum of all elements in \a x. Equivalent to `reduce(x, std::plus<>{})`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline T hadd(const basic_vec<T, N, A> &x) { return hadd(to_simd(x)); }
+	[[nodiscard]] constexpr T hadd(const basic_vec<T, N, A> &x)
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, std::plus<>{});
+		return hadd(to_simd(x));
+	}
 	/** Finds the horizontal product of all elements in \a x. Equivalent to `reduce(x, std::multiplies<>{})`. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline T hmul(const basic_vec<T, N, A> &x) { return hmul(to_simd(x)); }
+	[[nodiscard]] constexpr T hmul(const basic_vec<T, N, A> &x)
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, std::multiplies<>{});
+		return hmul(to_simd(x));
+	}
 
 	/** Finds the horizontal bitwise AND of all elements in \a x. Equivalent to `reduce(x, std::bit_and<>{})`. */
 	template<typename T, std::size_t N, typename A>
@@ -833,26 +975,50 @@ namespace sek
 
 	/** Finds the horizontal minimum of elements in \a x. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline T hmin(const basic_vec<T, N, A> &x) { return hmin(to_simd(x)); }
+	[[nodiscard]] constexpr T hmin(const basic_vec<T, N, A> &x)
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, [](T a, T b) { return std::min(a, b); });
+		return hmin(to_simd(x));
+	}
 	/** Finds the horizontal maximum of elements in \a x. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline T hmax(const basic_vec<T, N, A> &x) { return hmax(to_simd(x)); }
+	[[nodiscard]] constexpr T hmax(const basic_vec<T, N, A> &x)
+	{
+		if (std::is_constant_evaluated()) return detail::const_reduce(x, [](T a, T b) { return std::max(a, b); });
+		return hmax(to_simd(x));
+	}
 #pragma endregion
 
 #pragma region "basic_vec algorithms"
 	/** Returns a vector of minimum elements of \a a and \a b. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> min(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b) noexcept { return {dpm::min(to_simd(a), to_simd(b))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> min(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T x, T y) { return std::min(x, y); }, a, b);
+		return {dpm::min(to_simd(a), to_simd(b))};
+	}
 	/** Returns a vector of maximum elements of \a a and \a b. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> max(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b) noexcept { return {dpm::max(to_simd(a), to_simd(b))}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> max(const basic_vec<T, N, A> &a, const basic_vec<T, N, A> &b) noexcept
+	{
+		if (std::is_constant_evaluated()) return detail::const_apply<basic_vec<T, N, A>>([](T x, T y) { return std::max(x, y); }, a, b);
+		return {dpm::max(to_simd(a), to_simd(b))};
+	}
 
 	/** Returns a vector of minimum elements of \a a and scalar \a b. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> min(const basic_vec<T, N, A> &a, T b) noexcept { return {dpm::min(to_simd(a), b)}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> min(const basic_vec<T, N, A> &a, T b) noexcept
+	{
+		if (std::is_constant_evaluated()) return min(a, basic_vec<T, N, A>{b});
+		return {dpm::min(to_simd(a), b)};
+	}
 	/** Returns a vector of maximum elements of \a a and scalar \a b. */
 	template<typename T, std::size_t N, typename A>
-	[[nodiscard]] inline basic_vec<T, N, A> max(const basic_vec<T, N, A> &a, T b) noexcept { return {dpm::max(to_simd(a), b)}; }
+	[[nodiscard]] constexpr basic_vec<T, N, A> max(const basic_vec<T, N, A> &a, T b) noexcept
+	{
+		if (std::is_constant_evaluated()) return max(a, basic_vec<T, N, A>{b});
+		return {dpm::max(to_simd(a), b)};
+	}
 
 	/** Returns a pair of vectors of minimum and maximum elements of \a a and \a b. */
 	template<typename T, std::size_t N, typename A>
@@ -10,85 +10,151 @@
 
 namespace sek::detail
 {
+	/* Constant-evaluated fallbacks for functions implemented via intrinsics or the C library. Intermediate results are
+	 * computed in `long double` to keep the error of the fallbacks within a few ULP of the runtime implementations. */
+	template<std::floating_point T>
+	[[nodiscard]] constexpr T const_sqrt(T x) noexcept
+	{
+		if (x != x || x < T{0}) return std::numeric_limits<T>::quiet_NaN();
+		if (x == T{0} || x == std::numeric_limits<T>::infinity()) return x;
+
+		/* Newton iterations starting above the root decrease monotonically until they converge. */
+		const auto lx = static_cast<long double>(x);
+		for (auto y = lx < 1.0l ? 1.0l : lx;;)
+		{
+			const auto next = (y + lx / y) / 2.0l;
+			if (next >= y) return static_cast<T>(y);
+			y = next;
+		}
+	}
+	template<std::floating_point T>
+	[[nodiscard]] constexpr std::pair<T, T> const_sincos(T x) noexcept
+	{
+		constexpr auto half_pi = 1.570796326794896619231321691639751442l;
+		if (x != x || x == std::numeric_limits<T>::infinity() || x == -std::numeric_limits<T>::infinity())
+			return {std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()};
+
+		/* Reduce to [-pi/4, pi/4] and select the quadrant. */
+		const auto lx = static_cast<long double>(x);
+		const auto k = static_cast<long long>(lx / half_pi + (lx < 0.0l ? -0.5l : 0.5l));
+		const auto r = lx - static_cast<long double>(k) * half_pi;
+
+		auto s = r, c = 1.0l;
+		auto s_term = r, c_term = 1.0l;
+		for (int i = 1; i < 16; ++i)
+		{
+			s_term *= -r * r / static_cast<long double>((2 * i) * (2 * i + 1));
+			c_term *= -r * r / static_cast<long double>((2 * i - 1) * (2 * i));
+			s += s_term;
+			c += c_term;
+		}
+
+		switch (k & 3)
+		{
+			case 0: return {static_cast<T>(s), static_cast<T>(c)};
+			case 1: return {static_cast<T>(c), static_cast<T>(-s)};
+			case 2: return {static_cast<T>(-s), static_cast<T>(-c)};
+			default: return {static_cast<T>(-c), static_cast<T>(s)};
+		}
+	}
+
 	/* Dot product of a vector with itself is assumed to never be negative, as such no error checking is needed. */
 #ifdef __SSE__
-	[[nodiscard]] inline float sqrt(float dp) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(dp))); }
+	[[nodiscard]] constexpr float sqrt(float dp) noexcept
+	{
+		if (std::is_constant_evaluated()) return const_sqrt(dp);
+		return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(dp)));
+	}
 	/* rsqrt breaks constant folding and is less precise than 1 / sqrt(x). */
 	//[[nodiscard]] inline float rsqrt(float dp) noexcept { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(dp))); }
 #endif
 #ifdef __SSE2__
-	[[nodiscard]] inline double sqrt(double dp) noexcept
+	[[nodiscard]] constexpr double sqrt(double dp) noexcept
 	{
+		if (std::is_constant_evaluated()) return const_sqrt(dp);
 		const auto v_dp = _mm_set_sd(dp);
 		return _mm_cvtsd_f64(_mm_sqrt_sd(v_dp, v_dp));
 	}
 #endif
 	template<typename T>
-	[[nodiscard]] inline T sqrt(T dp) noexcept { return static_cast<T>(std::sqrt(dp)); }
+	[[nodiscard]] constexpr T sqrt(T dp) noexcept
+	{
+		if constexpr (std::floating_point<T>)
+			if (std::is_constant_evaluated()) return const_sqrt(dp);
+		return static_cast<T>(std::sqrt(dp));
+	}
 	template<typename T>
-	[[nodiscard]] inline T rsqrt(T dp) noexcept { return static_cast<T>(1) / sqrt(dp); }
+	[[nodiscard]] constexpr T rsqrt(T dp) noexcept { return static_cast<T>(1) / sqrt(dp); }
 
 	template<typename T>
-	[[nodiscard]] inline T fmadd(T a, T b, T c) noexcept { return a * b + c; }
+	[[nodiscard]] constexpr T fmadd(T a, T b, T c) noexcept { return a * b + c; }
 	template<typename T>
-	[[nodiscard]] inline T fmsub(T a, T b, T c) noexcept { return a * b - c; }
+	[[nodiscard]] constexpr T fmsub(T a, T b, T c) noexcept { return a * b - c; }
 	template<typename T>
-	[[nodiscard]] inline T fnmadd(T a, T b, T c) noexcept { return -(a * b) + c; }
+	[[nodiscard]] constexpr T fnmadd(T a, T b, T c) noexcept { return -(a * b) + c; }
 	template<typename T>
-	[[nodiscard]] inline T fnmsub(T a, T b, T c) noexcept { return -(a * b) - c; }
+	[[nodiscard]] constexpr T fnmsub(T a, T b, T c) noexcept { return -(a * b) - c; }
 #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
-	[[nodiscard]] inline float fmadd(float a, float b, float c) noexcept
+	[[nodiscard]] constexpr float fmadd(float a, float b, float c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b + c;
 		const auto va = _mm_set_ss(a);
 		const auto vb = _mm_set_ss(b);
 		const auto vc = _mm_set_ss(c);
 		return _mm_cvtss_f32(_mm_fmadd_ss(va, vb, vc));
 	}
-	[[nodiscard]] inline float fmsub(float a, float b, float c) noexcept
+	[[nodiscard]] constexpr float fmsub(float a, float b, float c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b - c;
 		const auto va = _mm_set_ss(a);
 		const auto vb = _mm_set_ss(b);
 		const auto vc = _mm_set_ss(c);
 		return _mm_cvtss_f32(_mm_fmsub_ss(va, vb, vc));
 	}
-	[[nodiscard]] inline float fnmadd(float a, float b, float c) noexcept
+	[[nodiscard]] constexpr float fnmadd(float a, float b, float c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) + c;
 		const auto va = _mm_set_ss(a);
 		const auto vb = _mm_set_ss(b);
 		const auto vc = _mm_set_ss(c);
 		return _mm_cvtss_f32(_mm_fnmadd_ss(va, vb, vc));
 	}
-	[[nodiscard]] inline float fnmsub(float a, float b, float c) noexcept
+	[[nodiscard]] constexpr float fnmsub(float a, float b, float c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) - c;
 		const auto va = _mm_set_ss(a);
 		const auto vb = _mm_set_ss(b);
 		const auto vc = _mm_set_ss(c);
 		return _mm_cvtss_f32(_mm_fnmsub_ss(va, vb, vc));
 	}
 
-	[[nodiscard]] inline double fmadd(double a, double b, double c) noexcept
+	[[nodiscard]] constexpr double fmadd(double a, double b, double c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b + c;
 		const auto va = _mm_set_sd(a);
 		const auto vb = _mm_set_sd(b);
 		const auto vc = _mm_set_sd(c);
 		return _mm_cvtsd_f64(_mm_fmadd_sd(va, vb, vc));
 	}
-	[[nodiscard]] inline double fmsub(double a, double b, double c) noexcept
+	[[nodiscard]] constexpr double fmsub(double a, double b, double c) noexcept
 	{
+		if (std::is_constant_evaluated()) return a * b - c;
 		const auto va = _mm_set_sd(a);
 		const auto vb = _mm_set_sd(b);
 		const auto vc = _mm_set_sd(c);
 		return _mm_cvtsd_f64(_mm_fmsub_sd(va, vb, vc));
 	}
-	[[nodiscard]] inline double fnmadd(double a, double b, double c) noexcept
+	[[nodiscard]] constexpr double fnmadd(double a, double b, double c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) + c;
 		const auto va = _mm_set_sd(a);
 		const auto vb = _mm_set_sd(b);
 		const auto vc = _mm_set_sd(c);
 		return _mm_cvtsd_f64(_mm_fnmadd_sd(va, vb, vc));
 	}
-	[[nodiscard]] inline double fnmsub(double a, double b, double c) noexcept
+	[[nodiscard]] constexpr double fnmsub(double a, double b, double c) noexcept
 	{
+		if (std::is_constant_evaluated()) return -(a * b) - c;
 		const auto va = _mm_set_sd(a);
 		const auto vb = _mm_set_sd(b);
 		const auto vc = _mm_set_sd(c);
@@ -183,31 +249,36 @@ namespace sek::detail
 	}
 
 	template<typename T>
-	[[nodiscard]] inline std::pair<T, T> sincos(T x) noexcept
+	[[nodiscard]] constexpr std::pair<T, T> sincos(T x) noexcept
 	{
+		if constexpr (std::floating_point<T>)
+			if (std::is_constant_evaluated()) return const_sincos(x);
 		return {std::sin(x), std::cos(x)};
 	}
 
 #ifdef __has_builtin
 #if __has_builtin(__builtin_sincosf)
-	[[nodiscard]] inline std::pair<float, float> sincos(float x) noexcept
+	[[nodiscard]] constexpr std::pair<float, float> sincos(float x) noexcept
 	{
+		if (std::is_constant_evaluated()) return const_sincos(x);
 		std::pair<float, float> result;
 		__builtin_sincosf(x, &result.first, &result.second);
 		return result;
 	}
 #endif
 #if __has_builtin(__builtin_sincos)
-	[[nodiscard]] inline std::pair<double, double> sincos(double x) noexcept
+	[[nodiscard]] constexpr std::pair<double, double> sincos(double x) noexcept
 	{
+		if (std::is_constant_evaluated()) return const_sincos(x);
 		std::pair<double, double> result;
 		__builtin_sincos(x, &result.first, &result.second);
 		return result;
 	}
 #endif
 #if __has_builtin(__builtin_sincosl)
-	[[nodiscard]] inline std::pair<long double, long double> sincos(long double x) noexcept
+	[[nodiscard]] constexpr std::pair<long double, long double> sincos(long double x) noexcept
 	{
+		if (std::is_constant_evaluated()) return const_sincos(x);
 		std::pair<long double, long double> result;
 		__builtin_sincosl(x, &result.first, &result.second);
 		return result;
@@ -4,9 +4,12 @@
 
 #pragma once
 
-#include "define.hpp"
+#include "type_vec.hpp"
+#include "xoroshiro_jump.hpp"
 
 #include <type_traits>
+#include <cstring>
+#include <span>
 #include <concepts>
 #include <iomanip>
 #include <limits>
@@ -28,6 +31,19 @@ namespace sek
 		constexpr static auto uint64_to_double(auto value) noexcept { return static_cast<double>(value >> 11) * 0x1.0p-53; }
 		constexpr static auto uint32_to_float(auto value) noexcept { return static_cast<float>(value >> 8) * 0x1.0p-24f; }
 
+		/* Converts random integer bits to floating-point values within [0, 1) using the top mantissa-width bits.
+		 * Equivalent to `uint64_to_double` & `uint32_to_float` for the corresponding types. */
+		template<std::floating_point T, typename U, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE auto vec_bits_to_unit(const basic_vec<U, N, A> &x) noexcept requires (std::numeric_limits<U>::digits >= std::numeric_limits<T>::digits)
+		{
+			constexpr auto digits = std::numeric_limits<T>::digits;
+			constexpr auto shift = std::numeric_limits<U>::digits - digits;
+
+			using result_t = vec<T, N>;
+			const auto bits = result_t{dpm::static_simd_cast<typename result_t::simd_type>(to_simd(x >> U{shift}))};
+			return bits * result_t{T{1} / static_cast<T>(U{1} << digits)};
+		}
+
 		template<typename, std::size_t>
 		struct impl_xoroshiro;
 
@@ -41,6 +57,8 @@ namespace sek
 			constexpr static std::uint64_t initial[] = {0x4424e023cd1d52, 0x53e25f3254fc82, 0x182982e2f107bb, 0x0ef936c5c27271};
 			constexpr static std::uint64_t jmp_short[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
 			constexpr static std::uint64_t jmp_long[] = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635};
+			constexpr static const auto &charpoly = xoshiro256_charpoly;
+			constexpr static const auto &jmp_pow2 = xoshiro256_jmp_pow2;
 
 			constexpr auto do_next() noexcept
 			{
@@ -89,6 +107,8 @@ namespace sek
 			constexpr static std::uint64_t initial[] = {0x4424e0232e2f107b, 0x70865936c5c27271};
 			constexpr static std::uint64_t jmp_short[] = {0xdf900294d8f554a5, 0x170865df4b3201fc};
 			constexpr static std::uint64_t jmp_long[] = {0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1};
+			constexpr static const auto &charpoly = xoroshiro128_charpoly;
+			constexpr static const auto &jmp_pow2 = xoroshiro128_jmp_pow2;
 
 			constexpr auto do_next() noexcept
 			{
@@ -100,7 +120,7 @@ namespace sek
 				m_state[0] = std::rotl(si0, 24) ^ si1 ^ (si1 << 16);
 				m_state[1] = std::rotl(si1, 37);
 
-				return uint64_to_double(result);
+				return result;
 			}
 			constexpr void do_jump(const state_type &jmp_arr) noexcept
 			{
@@ -132,8 +152,11 @@ namespace sek
 			constexpr static state_type initial = {0x4424e023cd1d52, 0x53e25f3254fc82, 0x182982e2f107bb, 0x0ef936c5c27271};
 			constexpr static state_type jmp_short = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
 			constexpr static state_type jmp_long = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635};
+			constexpr static const auto &charpoly = xoshiro256_charpoly;
+			constexpr static const auto &jmp_pow2 = xoshiro256_jmp_pow2;
 
-			constexpr auto do_next() noexcept
+			constexpr auto do_next() noexcept { return uint64_to_double(do_next_bits()); }
+			constexpr seed_type do_next_bits() noexcept
 			{
 				const auto result = m_state[0] + m_state[3];
 				const auto tmp = m_state[1] << 17;
@@ -146,7 +169,7 @@ namespace sek
 				m_state[2] ^= tmp;
 				m_state[3] = std::rotl(m_state[3], 45);
 
-				return uint64_to_double(result);
+				return result;
 			}
 			constexpr void do_jump(const state_type &jmp_arr) noexcept
 			{
@@ -180,8 +203,11 @@ namespace sek
 			constexpr static std::uint64_t initial[] = {0x4424e0232e2f107b, 0x70865936c5c27271};
 			constexpr static std::uint64_t jmp_short[] = {0xdf900294d8f554a5, 0x170865df4b3201fc};
 			constexpr static std::uint64_t jmp_long[] = {0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1};
+			constexpr static const auto &charpoly = xoroshiro128_charpoly;
+			constexpr static const auto &jmp_pow2 = xoroshiro128_jmp_pow2;
 
-			constexpr auto do_next() noexcept
+			constexpr auto do_next() noexcept { return uint64_to_double(do_next_bits()); }
+			constexpr seed_type do_next_bits() noexcept
 			{
 				auto s0 = m_state[0];
 				auto s1 = m_state[1];
@@ -191,7 +217,7 @@ namespace sek
 				m_state[0] = std::rotl(s0, 24) ^ s1 ^ (s1 << 16);
 				m_state[1] = std::rotl(s1, 37);
 
-				return uint64_to_double(result);
+				return result;
 			}
 			constexpr void do_jump(const state_type &jmp_arr) noexcept
 			{
@@ -224,6 +250,8 @@ namespace sek
 			constexpr static state_type initial = {0x4e2e2f7b, 0x836c6597, 0xf542d035, 0xa0e582d5};
 			constexpr static state_type jmp_short = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
 			constexpr static state_type jmp_long = {0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662};
+			constexpr static const auto &charpoly = xoshiro128_charpoly;
+			constexpr static const auto &jmp_pow2 = xoshiro128_jmp_pow2;
 
 			constexpr auto do_next() noexcept
 			{
@@ -250,6 +278,8 @@ namespace sek
 						{
 							tmp[0] ^= m_state[0];
 							tmp[1] ^= m_state[1];
+							tmp[2] ^= m_state[2];
+							tmp[3] ^= m_state[3];
 						}
 						do_next();
 					}
@@ -270,8 +300,11 @@ namespace sek
 			constexpr static std::uint32_t initial[] = {0x4e2e2f7b, 0x836c6597, 0xf542d035, 0xa0e582d5};
 			constexpr static std::uint32_t jmp_short[] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
 			constexpr static std::uint32_t jmp_long[] = {0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662};
+			constexpr static const auto &charpoly = xoshiro128_charpoly;
+			constexpr static const auto &jmp_pow2 = xoshiro128_jmp_pow2;
 
-			constexpr auto do_next() noexcept
+			constexpr auto do_next() noexcept { return uint32_to_float(do_next_bits()); }
+			constexpr seed_type do_next_bits() noexcept
 			{
 				const auto result = m_state[0] + m_state[3];
 				const auto tmp = m_state[1] << 9;
@@ -284,7 +317,7 @@ namespace sek
 				m_state[2] ^= tmp;
 				m_state[3] = std::rotl(m_state[3], 11);
 
-				return uint32_to_float(result);
+				return result;
 			}
 			constexpr void do_jump(const state_type &jmp_arr) noexcept
 			{
@@ -296,6 +329,8 @@ namespace sek
 						{
 							tmp[0] ^= m_state[0];
 							tmp[1] ^= m_state[1];
+							tmp[2] ^= m_state[2];
+							tmp[3] ^= m_state[3];
 						}
 						do_next();
 					}
@@ -306,10 +341,36 @@ namespace sek
 
 			state_type m_state;
 		};
+
+		/* Returns the next raw (unconverted) random bits of generator `g`. */
+		template<typename T, std::size_t W>
+		[[nodiscard]] SEK_FORCEINLINE auto next_bits(impl_xoroshiro<T, W> &g) noexcept
+		{
+			if constexpr (std::floating_point<T>)
+				return g.do_next_bits();
+			else
+				return g.do_next();
+		}
+		/* Writes `n` next raw random bit words of generator `g` to `out`. The recurrence is unrolled 4 times. */
+		template<typename T, std::size_t W, typename U>
+		SEK_FORCEINLINE void fill_bits(impl_xoroshiro<T, W> &g, U *out, std::size_t n) noexcept
+		{
+			std::size_t i = 0;
+			for (; i + 4 <= n; i += 4)
+			{
+				out[i + 0] = next_bits(g);
+				out[i + 1] = next_bits(g);
+				out[i + 2] = next_bits(g);
+				out[i + 3] = next_bits(g);
+			}
+			for (; i < n; ++i) out[i] = next_bits(g);
+		}
 	}
 
 	template<typename, std::size_t>
 	class xoroshiro;
+	template<typename, std::size_t, std::size_t>
+	class xoroshiro_simd;
 
 	template<typename C, typename Tr, typename T, std::size_t W>
 	inline std::basic_ostream<C, Tr> &operator<<(std::basic_ostream<C, Tr> &, const xoroshiro<T, W> &);
@@ -329,6 +390,10 @@ namespace sek
 		friend inline std::basic_ostream<C, Tr> &operator<<(std::basic_ostream<C, Tr> &, const xoroshiro<U, W> &);
 		template<typename C, typename Tr, typename U, std::size_t W>
 		friend inline std::basic_istream<C, Tr> &operator>>(std::basic_istream<C, Tr> &, xoroshiro<U, W> &);
+		template<typename, std::size_t, std::size_t>
+		friend class xoroshiro_simd;
+		template<typename>
+		friend struct serial_traits;
 
 	public:
 		using seed_type = typename base_t::seed_type;
@@ -366,21 +431,116 @@ namespace sek
 		/** @copydoc next */
 		constexpr result_type operator()() noexcept { return next(); }
 
-		/** Advances the generator by `n`. */
-		constexpr void discard(std::size_t n) noexcept
+		/** Fills \a out with random numbers. Equivalent to calling `next()` for every element of \a out. */
+		void generate(std::span<result_type> out) noexcept
+		{
+			if constexpr (std::floating_point<result_type>)
+				fill_uniform(out.data(), out.size(), result_type{0}, result_type{1});
+			else
+			{
+				/* Generator state is copied to a local so that it can stay in registers for the entire loop. */
+				auto gen = static_cast<const base_t &>(*this);
+				detail::fill_bits(gen, out.data(), out.size());
+				static_cast<base_t &>(*this) = gen;
+			}
+		}
+		/** Fills \a out with random floating-point numbers uniformly distributed within [\a lo, \a hi).
+		 * @note Every element consumes one random number of the generator. */
+		template<std::floating_point U>
+		void generate_uniform(std::span<U> out, U lo, U hi) noexcept requires (std::numeric_limits<seed_type>::digits >= std::numeric_limits<U>::digits)
+		{
+			fill_uniform(out.data(), out.size(), lo, hi);
+		}
+		/** Fills \a out with random bytes. */
+		void generate_bits(std::span<std::byte> out) noexcept
+		{
+			auto gen = static_cast<const base_t &>(*this);
+			std::size_t i = 0;
+			for (seed_type buff[4]; i + sizeof(buff) <= out.size(); i += sizeof(buff))
+			{
+				detail::fill_bits(gen, buff, 4);
+				std::memcpy(out.data() + i, buff, sizeof(buff));
+			}
+			for (seed_type word; i < out.size(); i += sizeof(word))
+			{
+				word = detail::next_bits(gen);
+				std::memcpy(out.data() + i, &word, std::min(sizeof(word), out.size() - i));
+			}
+			static_cast<base_t &>(*this) = gen;
+		}
+
+		/** Advances the generator by `n`.
+		 * @note Distances exceeding `Width` are advanced via a jump polynomial, which requires at most `Width` steps. */
+		constexpr void discard(std::size_t n) noexcept { discard(0, n); }
+		/** Advances the generator by the 128-bit distance `hi * 2^64 + lo`.
+		 * @note Distances exceeding `Width` are advanced via a jump polynomial, which requires at most `Width` steps. */
+		constexpr void discard(std::uint64_t hi, std::uint64_t lo) noexcept
 		{
-			/* No fast jump here, `n` max is < 2^128. */
-			while (n-- > 0) next();
+			if (hi != 0 || lo > Width)
+			{
+				typename base_t::state_type poly = {};
+				detail::jump_poly(hi, lo, base_t::jmp_pow2, base_t::charpoly, poly);
+				base_t::do_jump(poly);
+			}
+			else
+				while (lo-- > 0) next();
 		}
 
 		/** Advances the generator by 2^128. */
 		constexpr void jump() noexcept { base_t::do_jump(base_t::jmp_short); }
 		/** Advances the generator by 2^192. */
 		constexpr void long_jump() noexcept { base_t::do_jump(base_t::jmp_long); }
+		/** Advances the generator by `n` jumps. Equivalent to calling `jump()` `n` times.
+		 * @note Jump polynomials are combined, so that the generator is only advanced once. */
+		constexpr void jump(std::size_t n) noexcept { jump_n(base_t::jmp_short, n); }
+		/** Advances the generator by `n` long jumps. Equivalent to calling `long_jump()` `n` times.
+		 * @note Jump polynomials are combined, so that the generator is only advanced once. */
+		constexpr void long_jump(std::size_t n) noexcept { jump_n(base_t::jmp_long, n); }
 
 		[[nodiscard]] constexpr bool operator==(const xoroshiro &) const noexcept = default;
 
 	private:
+		constexpr void jump_n(const typename base_t::state_type &jmp, std::size_t n) noexcept
+		{
+			if (n == 0) return;
+
+			typename base_t::state_type poly = {};
+			detail::jump_poly_pow(jmp, n, base_t::charpoly, poly);
+			base_t::do_jump(poly);
+		}
+
+		template<typename U>
+		void fill_uniform(U *out, std::size_t n, U lo, U hi) noexcept
+		{
+			using bits_t = native_vec<seed_type>;
+			using unit_t = vec<U, bits_t{}.size()>;
+			constexpr auto w = bits_t{}.size();
+			constexpr auto align = alignof(typename bits_t::simd_type);
+
+			/* Random bits are generated in blocks of `native_vec<seed_type>::size()` and converted to floating-point lane-parallel. */
+			const auto a = unit_t{hi - lo}, b = unit_t{lo};
+			auto gen = static_cast<const base_t &>(*this);
+			alignas(align) seed_type buff[w] = {};
+			for (std::size_t i = 0; i < n; i += w)
+			{
+				const auto k = std::min(w, n - i);
+				detail::fill_bits(gen, buff, k);
+
+				bits_t bits;
+				to_simd(bits).copy_from(buff, dpm::vector_aligned);
+				const auto u = detail::vec_bits_to_unit<U>(bits) * a + b;
+				if (k < w) [[unlikely]]
+				{
+					U tail[w];
+					to_simd(u).copy_to(tail, dpm::element_aligned);
+					std::copy_n(tail, k, out + i);
+				}
+				else
+					to_simd(u).copy_to(out + i, dpm::element_aligned);
+			}
+			static_cast<base_t &>(*this) = gen;
+		}
+
 		[[nodiscard]] constexpr auto &state() noexcept { return base_t::m_state; }
 		[[nodiscard]] constexpr const auto &state() const noexcept { return base_t::m_state; }
 	};
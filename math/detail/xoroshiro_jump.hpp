@@ -0,0 +1,466 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Jump-ahead of the xoroshiro family is done via GF(2) polynomials. Advancing the state by `n` steps is equivalent to
+		 * applying the polynomial `x^n mod charpoly` to the state transition, which requires `Width` steps of the generator
+		 * regardless of `n`. The polynomial itself is assembled from the precomputed table of `x^(2^i) mod charpoly`. */
+
+		/* Characteristic polynomial of the 256-bit `xoshiro` (4x64-bit state) transition, without the implicit leading term. */
+		inline constexpr std::uint64_t xoshiro256_charpoly[4] = {0x9d116f2bb0f0f001, 0x0280002bcefd1a5e, 0x04b4edcf26259f85, 0x0003c03c3f3ecb19};
+		/* Jump polynomials `x^(2^i) mod charpoly` of the 256-bit `xoshiro` (4x64-bit state) transition. */
+		inline constexpr std::uint64_t xoshiro256_jmp_pow2[128][4] = {
+			{0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000000010, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000000100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000100000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000000000, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000},
+			{0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000},
+			{0x9d116f2bb0f0f001, 0x0280002bcefd1a5e, 0x04b4edcf26259f85, 0x0003c03c3f3ecb19},
+			{0xc7327d130e34b489, 0x81f675e7a4ef7d84, 0x6dd49b656055c9da, 0xbe7976372e930435},
+			{0x060106bbbe4ff028, 0x1be1d76854ddda93, 0x8456faeb6230d984, 0x65507439cf43f0e2},
+			{0x876c2301125a85c0, 0x15fe822628b16f04, 0x3c8ca36ec9a74fa7, 0x51edef31819e01ff},
+			{0xd7f4e8da7e228b85, 0xd638d47ec5bcf595, 0xaa6eb691cbf9ce10, 0x0f41cce3698fad39},
+			{0x669da12373880674, 0xb1df898a4a6f1548, 0x32104b94fe2534d3, 0xda66e09e52b341d1},
+			{0x4f20eb915e780231, 0x3886af219b885248, 0x023ecbee3f717fce, 0x3cec2c375bef249c},
+			{0x449b3ae793888c8c, 0xc3ce2f061f077568, 0xa69393ac0d837e54, 0x1a9dcf944ae47603},
+			{0x7e89ac5ca2fbf2c7, 0x92ae7ca370c0bf6b, 0xef43beaa06f02fb8, 0xd87f8ce230817a21},
+			{0x6c4adbe18e29df8a, 0x54adade3697d477f, 0xf0c168649cdba61f, 0xbd53027696368bbb},
+			{0x1a673fecf40e36b8, 0xf2c602feb5ed002b, 0x1ea49b5067452594, 0xf78a97c0d882cd37},
+			{0xef4606da56224c47, 0x770323eab8d437bd, 0x590923d02ec52531, 0x1639a36e0968e3c5},
+			{0x31d9d05c5d95f3cd, 0x7cde241817a3ce0f, 0x2f679f694a74c76a, 0x8b3919a9d298a415},
+			{0x6b6622ae9590047a, 0xeace6d3840b79fef, 0xd9b36372fd70ec83, 0x624eb7b63c322e71},
+			{0x1b91fd9ba98d9e23, 0xeb2c7e29d3c33d2e, 0xcebbfd2ef4e9aff4, 0x2bac5517c9469796},
+			{0x01f356e6083fe109, 0xba0ffb6562a3a28a, 0x657a6b736317866b, 0xfb678bd3e5dac186},
+			{0xc5461100f197a7e8, 0xe46916a1426b676d, 0xf3469dbb4fe25d26, 0xf5c010059e83bc3f},
+			{0x22dc028cb8c259dc, 0x3eec4eb6495ce5aa, 0x5de3e273dc7b84dc, 0xe677849e207f6afd},
+			{0x832d418900fd3b0f, 0x114e10c3b7c36788, 0xdf2332a778d9c8dc, 0x0d19a1bdceb7522c},
+			{0xe2d0c9c10e8d7157, 0x8b3ed7c37e947e38, 0x98273f4d18ad073e, 0xf38f7e750d5f4f2a},
+			{0xe7109518f3510d70, 0x34f30137eadb90b9, 0x6d48dd206d56754d, 0xafa9e3fe5fea15c3},
+			{0x8ee774f507ec9f39, 0xd7c26ebd51ecf6c4, 0xc76a456d998ddc4c, 0x1ca234ff511bcb05},
+			{0x4905d8261158a7bc, 0x352f8b5d2137de83, 0xe0e9fa345826626d, 0x3e667662caa54d16},
+			{0x272a32be4bac7912, 0xe1185a166bb38173, 0x82b9aa358fe2ed58, 0xa43d37468704d536},
+			{0x58120d583c112f69, 0x7d8d0632bd08e6ac, 0x214fafc0fbdbc208, 0x0e055d3520fdb9d7},
+			{0xd9eb3e225a9ebb7d, 0x5d33a22177777716, 0xffed2ffbcf857b42, 0xa1b7ebf581a90f09},
+			{0x3a433a5cff8501f4, 0x0c2e65cfa3a44f3b, 0xa59f09ab33f1c8f4, 0x0afe97309a7881b0},
+			{0x635e9c6882ce5c6a, 0x53a34398808ef457, 0x94295f82142a68bd, 0xc1cdf918a717c897},
+			{0x1a2c804af78e2ed4, 0x306c4d371040af1e, 0x63d3f9df102dfa7e, 0xac7fe0806aecd6c8},
+			{0x7743a154e17a5e9b, 0x7823a1cd9453899b, 0x976589eefbb1c7f5, 0x702cf168260fa29e},
+			{0x2edfce1b0667bf3f, 0x68ef5242f2d9c5b2, 0x03803bdb9ea7d7e8, 0xc4671ec91b902bae},
+			{0x4d2c07a0b0f7980f, 0x0af3e6140fcff185, 0xaf03bea7ea7109fd, 0x755b16e231d1e7c9},
+			{0xd24b31ab16542ea0, 0x13a31dc36460a3b0, 0xeece73d85df18361, 0x51fc9b8eb1974e73},
+			{0xec9c79ebd62a4a91, 0xa374bf9822d660aa, 0xde49d57f23fdecb5, 0xfb43cf1f4658ae1b},
+			{0x7602414a37bf1c08, 0x48b8b0570f008a91, 0x3aa3d49368a9c562, 0x9b48db8907d00f97},
+			{0xf7569be74f972355, 0x9e11e129fcced20e, 0xa6994477ec2d6d85, 0x8ec1a9dd27957370},
+			{0xc223943200d6e8a0, 0x82f1f8d3ebd9baff, 0xf6c987b8eb4f76db, 0xba8b1a7be4521854},
+			{0xe226bff99e7f9d4f, 0xf6faaff592dc08c7, 0xbad2e3487a438d37, 0xa8f7de3ed772d2d2},
+			{0x6322f95d362137f1, 0xb006241469247fbd, 0x181d6c749bfc7e7b, 0x3c63f6f95954e65e},
+			{0xaa878816402dab5f, 0x69811136f33b48fa, 0x0df6566ff12f17f4, 0x81f450881b843692},
+			{0xf11fb4faea62c7f1, 0xf825539dee5e4763, 0x474579292f705634, 0x5f728be2c97e9066},
+			{0xf18ac1f5eac5120e, 0x36d6c9bc4bcb56f5, 0xec104b9942b386be, 0x5ff98760441a364c},
+			{0x12b825906ddc86af, 0x168b84ac131ea856, 0xd1c440c801f3cddf, 0xb01e1ff4eb0b05f6},
+			{0x5696a9ed59ffcbe3, 0xb5bb35fe03c3158a, 0xf1ab1bce1577ad4e, 0x140bd5e4e00ffdaa},
+			{0x61507225f9f0e0fa, 0x8eadd052a304405f, 0x49c2df736ebe9c68, 0x5177664e86d5e31b},
+			{0x87aac36cc0c1abae, 0xca120d886e8fdf33, 0x5b8d5f58ce3357a7, 0xa93a7aadeced9cd7},
+			{0xd4eb47064a9ac499, 0x2b95939579346af1, 0xa6f4a2ea423cc2f6, 0xd5372758d87157ef},
+			{0x549bf83ef12aebc3, 0x56df3905d6712eed, 0xb86994c9cb3059a5, 0x7e0b8abe53e950f8},
+			{0x0b32b0dbe851dd9d, 0x27cc40c1479b95df, 0xc405c1164a3a6d49, 0x0888f2c33969763b},
+			{0x920a67ed72aa1155, 0x7e5cbd2047cefb5e, 0x31acd0e23e87d9d3, 0xfecb2b39fb96f078},
+			{0x9841d4c5510c4700, 0x97a6c4a0d2cdf9ac, 0x82f88d9e6b9b17c0, 0xf643cc9255f06741},
+			{0x30ac848541c0b04f, 0x55756dedb136961f, 0x65ba2fdf5fe59ed1, 0xe8e07ed05188af0f},
+			{0xadcede280bb92b99, 0x6d885bb5321527a7, 0x04ad0ecd62544db2, 0x679b88958f3bbdcb},
+			{0x84db0e338a94ce16, 0xaaee46b89b106201, 0xbbf25302a56d6131, 0xd10d621b74213644},
+			{0xed3c94e03147ca9b, 0x31fbe8b0a2035587, 0x5083dee093b632b7, 0x6ff477672ddf72b1},
+			{0x936ece877e64cc97, 0x22a36cdc0fda409f, 0xbae4d9a25a3928b9, 0xa9559a2368719526},
+			{0xb13c16e8096f0754, 0xb60d6c5b8c78f106, 0x34faff184785c20a, 0x12e4a2fbfc19bff9},
+			{0x69135f8ae4f3becb, 0xe9cd737204214bdf, 0x71c9cddcc21b4d96, 0x1e22c55ed04628f4},
+			{0x43f19411729e47a3, 0xcdc2f8abc30facd8, 0xd3c646ca742cfd35, 0xb6e16802c1e5a473},
+			{0xe1040fefa7016612, 0xcf7a45ddbd380c46, 0xe9121d42d889f1e6, 0x71583507471df592},
+			{0x7dc73de451f84f31, 0xef00865ccdc62b40, 0x3481941c63b9723b, 0x790035ed5d8a5206},
+			{0xb7fde9c10dde1033, 0xe2b26892066519e7, 0x1b2e1e5f58ca50e9, 0xc5245c9108c8303b},
+			{0xf7e31117fca1fde3, 0xd0229895c9855019, 0x80dd958fc2ce8b38, 0x72636702af55f1ae},
+			{0xf4fdf1938a08c423, 0x369b623ac732f278, 0x59970509d58afcb4, 0xaf24371b5a1a053d},
+			{0xe38bd8d6060eecb2, 0x4f2a8443cc705e1b, 0x98aea009de1e6b3b, 0xc2a214d5ccfdc9cc},
+			{0x779e326bea03051e, 0xfe60945b17507ff1, 0xb35a81ddfd74498b, 0x045c97103176ad4c},
+			{0xf99f64a8eef50acc, 0x967c5d39bff598c3, 0xe54b1f90f1804a5b, 0x8c79d3fd0cd87d25},
+			{0x5bf7c3946011203d, 0x00dc697c0ce8f5bf, 0x9b135f39cbd24442, 0x44a26649c72eaf79},
+			{0x1fe0ce6e4a5fbfa9, 0x05063f82926b1050, 0x6f0bd8889bc16b65, 0x621f84d4c5b7d5b2},
+			{0x0bd0d4953231dc02, 0x8cac609dd3f769ea, 0xa2ce3240999f0395, 0xafb60de4ef76f2d8},
+			{0xe41a05c6d5ad6443, 0xb46e28d0dd20be9c, 0x5d5a93bb678d1ff3, 0x6d9d47d177fda8e1},
+			{0x3750097bc18818df, 0xc05cb5489fabd6ba, 0xf671f175f29bd401, 0x69b492ad849876a0},
+			{0x6c1a4d1bee4cfb25, 0x0355dab5aaada356, 0x5d23c239088b488e, 0x2c09ebb60b81941a},
+			{0x85bc661b5fe4c77f, 0xa77d08c97aa93a7b, 0x1c4df4e6dc4daa6c, 0x3d8c3676399ece2d},
+			{0x0d50032e0877ba29, 0xb12fec5cc6984936, 0x97595ce59431e3aa, 0xd6fc185137af1d8b},
+			{0x49aa26e5d4bf7857, 0x754228fc68530845, 0xd5cace972fee73fa, 0x86b251394485c94b},
+			{0x8d480422727ca5ce, 0xdfd675636a53a2ad, 0xbff33c810d4f1e62, 0xb0baae7f98b528c0},
+			{0xb0908faa94bfc92c, 0x7d85e7cb6751bcbb, 0x6a4d1fd3bf02d558, 0x3fa865ff30ea93f7},
+			{0xd0d6be52a69e58c9, 0xa789c54654ca7c28, 0x5aa4dacdc52add36, 0x3c3c2884d98788bc},
+			{0x5f3f3b8fef0ed6b3, 0x41288120b4579cf8, 0x4c9ca45e4bc2a3c3, 0x15e0fed2f7bccfef},
+			{0xd262b21891db8d4e, 0x53b8a4a16a46d7c3, 0x9c885317a50787eb, 0xa949942afc5a2f2c},
+			{0x718aec6a573de99d, 0xc0a2019a1a152787, 0x4ea029ea5dbf8c1d, 0xfe740ffad9e17687},
+			{0x07f145f47c78ac8e, 0x35e2e29698d7eb0d, 0x228277008b5fb669, 0x77a27a67f88f49e1},
+			{0x6627da855e5050fb, 0x7c62ece20d8be011, 0x6648b4ef24a58856, 0x1029f062e580da26},
+			{0xa9ffe6995923a7b1, 0x34092a8e98b795be, 0x6f17a03a6bc6a877, 0xa0d23922f4dc9916},
+			{0x062e89b53f6cea07, 0x0ee2caf1df36f661, 0x35e67f142da25aca, 0x336f2f9401f82041},
+			{0xbf67135726c63517, 0x93b549a81fd07be4, 0xd617e92e93ea4567, 0xa3a29886c86c3cde},
+			{0x21ff06188c9cc699, 0xf9d3a86c856b8a26, 0xc51d91ed4856b46e, 0xfe0143fd314c9e7e},
+			{0x148c356c3114b7a9, 0xcdb45d7def42c317, 0xb27c05962ea56a13, 0x31eebb6c82a9615f},
+			{0x5d4da92b5d749ee7, 0xd8aed72f2c4c8d06, 0xd863413b92cae906, 0xc78709f4e0724160},
+			{0xc72a478e776aa7e8, 0xe2ece3b6969fe76a, 0xf59e618faaebae8a, 0x43b4a1c47d75f54a},
+			{0x85043fb7b5ec46d9, 0xb24feee905fd9032, 0xf018da68303dd3aa, 0x57f74d5c8e13eabe},
+			{0x1fe7835e4087fe62, 0xa797dd2a234c782b, 0x6bef1c2cbcff5536, 0xbf7e526feafe9fab},
+			{0x2b8e518ff5d4cf7b, 0x5aa27a4749244838, 0x75b4d7f6cc9f25e1, 0x944120083af78d61},
+			{0x3d6f902c3475cabe, 0x1bf5aad8660b3dff, 0x1965ee22fd231ead, 0xa1d8b4c28aebb851},
+			{0x8f55a96afe8c60d6, 0xc97a1beedb0cd181, 0x65e7e4d9e2832455, 0x9c9e175a184afb53},
+			{0x652cb4ccd4073f0f, 0x74b6da57ea2bc33a, 0x0a65eef991740328, 0xb9d862913d6f7e40},
+			{0x1045804fface6bf3, 0x10698e01c2ae9c87, 0xd4b46d9444c365a7, 0x82998b76e46a33d6},
+			{0x0a2c871d4e66d5cd, 0x02416381d70e6c43, 0xf1a9cb543a0bfa10, 0x8da69514b40b00e7},
+			{0xb79a9592b42dcf38, 0x4dc5ff02cd80ea1d, 0x83d4e917f16be77b, 0x27b45c44ee4a6229},
+			{0x4d5d5691e346a117, 0xae1e5f3ff8b47720, 0x219d46c745e04de7, 0x3762beab010e60b1},
+			{0xa26c20feb2ae9f7d, 0xb46fba890f1ca8f6, 0x634ad6497e9d5d70, 0x1cbf90cd7272db76},
+			{0xb0c0f65d5e452c0d, 0x9b34b9c8c6c9c0e0, 0x4fb63d3b5eb99097, 0x5f46daf7953c1bb3},
+			{0x7fafc3b0810db88e, 0xa08f672eaf81f898, 0x188dc353d2d4788a, 0x0127923940e883a8},
+			{0xff09f37df22eab9a, 0xe903694ada9d6795, 0x9a5475c8d2fb2d20, 0x19809df824096ba1},
+			{0x656c70a5f3f5c710, 0x861797e8573bfcd7, 0xe6a590ca622a3320, 0x7ea9fc3051e87b78},
+			{0x6aaa9929398cd48a, 0x5ad3eec2014d42b6, 0x84d72b234e8a5479, 0x644a875145d5d51f},
+			{0x6c738865ed73b377, 0x00659f02b37a017c, 0x203951cfd23e94cb, 0x6d2cc53f91af5f85},
+			{0xf7af674289519c6c, 0x8bc10737770d137e, 0xbef3d95e4e54413a, 0xc0864662b10083e8},
+			{0xf5238b0ff86d1867, 0x1d6286a155723d48, 0xeb185b3b61ef2507, 0xcecda49faf04bbfb},
+			{0x644b243f9d056a3a, 0x99c6cd156b9744df, 0xa02ccbd8d031b5d5, 0x2732a7244a31e5dd},
+			{0x25523b168236da8c, 0x75e9335039224b3b, 0xdf8f6390d609a5d4, 0x216f9077c64f36f6},
+			{0xc291983aa3a3a178, 0x565c9f7a11c40482, 0xef5b7611f90b7c08, 0x56ab0ca212a8d012},
+			{0xb400d4604c1d59db, 0xd73fe72ba2d98892, 0xc7abdfbc652abf3e, 0x45c2ad3649667c04},
+			{0x9bb885cd5aa00a8c, 0x543fa081564a326f, 0x058b3d55bfaa4aad, 0x91c1510f9b6f2ef8},
+			{0x7a3e03325fb2eeb7, 0x09cf7d85a86c1a90, 0x53c8dfba6c9aacae, 0x9d6ef09217bf59b7},
+			{0xe98651fa6fb0337b, 0x0bbfd59ed2151f31, 0xd8289b4ae487d7e1, 0xa1a3090ef816c214},
+			{0xaeb33557c76543fe, 0x1b18a0517cea386a, 0x56e93ecb5b361995, 0xaa72e405fb26c80a},
+			{0x46555cf90fc3d1cb, 0x57c811875c625284, 0x8397aeedc528c3f0, 0xfd4d894c8f82680a},
+			{0xeacbd852b93bd815, 0x4dd8801baa92fdda, 0xa50845f0f4301985, 0xd46cb8565abad18e}};
+
+		/* Characteristic polynomial of the 128-bit `xoroshiro` (2x64-bit state) transition, without the implicit leading term. */
+		inline constexpr std::uint64_t xoroshiro128_charpoly[2] = {0x095b8f76579aa001, 0x0008828e513b43d5};
+		/* Jump polynomials `x^(2^i) mod charpoly` of the 128-bit `xoroshiro` (2x64-bit state) transition. */
+		inline constexpr std::uint64_t xoroshiro128_jmp_pow2[128][2] = {
+			{0x0000000000000002, 0x0000000000000000},
+			{0x0000000000000004, 0x0000000000000000},
+			{0x0000000000000010, 0x0000000000000000},
+			{0x0000000000000100, 0x0000000000000000},
+			{0x0000000000010000, 0x0000000000000000},
+			{0x0000000100000000, 0x0000000000000000},
+			{0x0000000000000000, 0x0000000000000001},
+			{0x095b8f76579aa001, 0x0008828e513b43d5},
+			{0x162ad6ec01b26eae, 0x7a8ff5b1c465a931},
+			{0xb4fbaa5c54ee8b8f, 0xb18b0d36cd81a8f5},
+			{0x1207a1706bebb202, 0x23ac5e0ba1cecb29},
+			{0x2c88ef71166bc53d, 0xbb18e9c8d463bb1b},
+			{0xc3865bb154e9be10, 0xe3fbe606ef4e8e09},
+			{0x1a9fc99fa7818274, 0x28faaaebb31ee2db},
+			{0x588abd4c2ce2ba80, 0x30a7c4eef203c7eb},
+			{0x9c90debc053e8cef, 0xa425003f3220a91d},
+			{0xb82ca99a09a4e71e, 0x81e1dd96586cf985},
+			{0x35d69e118698a31d, 0x4f7fd3dfbb820bfb},
+			{0x49613606c466efd3, 0xfee2760ef3a900b3},
+			{0xbd031d011900a9e5, 0xf0df0531f434c57d},
+			{0x235e761b3b378590, 0x442576715266740c},
+			{0x3710a7ae7945df77, 0x1e8bae8f680d2b35},
+			{0x75d8e7dbceda609c, 0xfd7027fe6d2f6764},
+			{0xde2cba60cd3332b5, 0x28eff231ad438124},
+			{0x377e64c4e80a06fa, 0x1808760d0a0909a1},
+			{0x0cf0a2225da7fb95, 0xb9a362fafedfe9d2},
+			{0x2bab58a3cadfc0a3, 0xf57881ab117349fd},
+			{0x8d51ecdb9ed82455, 0x849272241425c996},
+			{0x521b29d0a57326c1, 0xf1ccb8898cbc07cd},
+			{0xfbe65017abec72dd, 0x61179e44214caafa},
+			{0x6c446b9bc95c267b, 0xd9aa6b1e93fbb6e4},
+			{0x64f80248d23655c6, 0x86e3772194563f6d},
+			{0xfad843622b252c78, 0xd4e95eef9edbdbc6},
+			{0x598742bbfddde630, 0x05667023c584a68a},
+			{0x3a9d7dce072134a6, 0x401aacf87a5e21ee},
+			{0xf0cc32eaf522f0e0, 0xe114b1e65a950e43},
+			{0xeb2beaa80d3fd8a7, 0x905dff85834fb8d1},
+			{0x61f29536e1bb6b99, 0xc449c069734817cb},
+			{0x390cd235d35187da, 0x1e5bc0fe7032f3df},
+			{0x744e5f1168ba3345, 0x3f399e6f1ea22dbc},
+			{0x8cc9aa88a153f5f8, 0xd47a02636f041cca},
+			{0x08d037056c80b9e0, 0xf83c06b106d3b7ab},
+			{0x4ce3c123d196bf7a, 0x14223eedae116a83},
+			{0xb1b206870da4e89a, 0x24bfd164204335ae},
+			{0x207bb2453717cf67, 0x4a5953c8f4bc2a51},
+			{0xa14e342bb11ff7e6, 0xf6b3f196dc551ccf},
+			{0x5422bca5015dd3b7, 0x5b6233b76fa214d7},
+			{0xede7341c00c65b85, 0xf20d7136458bd924},
+			{0xd769cfc9028deb78, 0x9b19ba6b3752065a},
+			{0xc7b0e531abe7e4bd, 0x4f27796502238c48},
+			{0x1c6d3ba4bb94182a, 0xb7b17dcd25003305},
+			{0x3ae9471d0e2d0bcf, 0xaaae579366147d07},
+			{0x8f9cd3794ca46fbf, 0x0d56bb288c661ccf},
+			{0xdb2ad4e9c15a9d4e, 0x0402342eedff424c},
+			{0x79e061af5be21395, 0x4e71559e6d0e7f00},
+			{0x96e7d88c0794e785, 0x8367af1c9d6c1406},
+			{0xccdda809db64b3e7, 0x0dbfcd2453d1d33f},
+			{0x6c64681c21cd0286, 0x3309e57f180d4ff6},
+			{0xacb8d4c6ba67113e, 0xb439f330ab3b9715},
+			{0xbad04ca5d96e2cd3, 0xc58f079d0205bcf3},
+			{0xebfbc2723a906760, 0x09417d8c80a37aa7},
+			{0x38ac01316167183d, 0x52f51ac639e09712},
+			{0x7a134006d4efa484, 0xf37ead6ea53b96ba},
+			{0x351561e58f8572d4, 0xdc1c01799cb8d734},
+			{0xdf900294d8f554a5, 0x170865df4b3201fc},
+			{0x2992ead4972eaed2, 0xb2a7b279a8cb1f50},
+			{0xc026a7d9e04a7700, 0xe7859c665be57882},
+			{0xb4cb6197dea2b1fe, 0x4b4a7aa8c389701c},
+			{0x0dcfc5b909e7df4d, 0xadb7753d55646eef},
+			{0x468431669864f789, 0xc80926301806a352},
+			{0x22b6c1736285fcc8, 0xc05da051ec96af1d},
+			{0x74c1daac8729d8bb, 0xf88f6bac8fd30448},
+			{0x847757c126b23e45, 0x752b98d002c408f7},
+			{0x0f9eaa62d0c9e2a3, 0x1aa7bc96dbace110},
+			{0x7475d71b98314377, 0xc469b29353a4984b},
+			{0xbbb7d266d61c85ea, 0x4b6dd41bce3bb499},
+			{0xc419b3742570e16f, 0xe023777e70b3a2f8},
+			{0x2a71db3a3ce8b968, 0x131e94fb35203d80},
+			{0x2897bb8961b4dce9, 0x9240c95b1e7fa08b},
+			{0xf0fc3553d7881d5f, 0xb879fca0915f893f},
+			{0xe754db3fbc7536bc, 0x2adca86fbefe1366},
+			{0x0a9e201adfe7baa9, 0x0a40a688d77855ba},
+			{0x1d0d601e49c35837, 0x17771c905e0775a8},
+			{0x9b031395aec7b584, 0x2cf775e419a607e0},
+			{0x79ead2eeddf66699, 0x93a7cf27dec9b306},
+			{0xe1b9805c107679fc, 0x93615189fe85b7d5},
+			{0x2c3925dcd790e3d6, 0x466421124b50fbfb},
+			{0xdca9b0fa4e95600e, 0x1cda7bd04e3bb94b},
+			{0xefc7905e1cbb5ffb, 0x5ec431d73bbfe49f},
+			{0x854414811d534483, 0x31a1f85fd532f302},
+			{0xadb9ba2958f30b6e, 0xed9b991c09177e2f},
+			{0x76f8fdf26b0d1cbb, 0x38d9e87dffdfca70},
+			{0x51f21cddcebdb8c7, 0xd8e9e7254052af4d},
+			{0xa03f796efb295305, 0x62769780d13fbc08},
+			{0x4f2083f6b19e628a, 0x66e5456c2eaedbff},
+			{0x8b2be9cd79734bed, 0xace8d6ce8e3fba17},
+			{0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1},
+			{0x4fff128094edd94c, 0x00d67dc46ad28695},
+			{0x726438e9a1d3c6ea, 0xf9540570703e7cf3},
+			{0x92cc6a0937c9d34e, 0x066a9599766619b5},
+			{0xc5730de058e1047f, 0xa4e540c7ac49aa1b},
+			{0xe408bbecda066551, 0xc2edfc1ab51c00ad},
+			{0xc5477ea8821ce588, 0xf11753a4339e78c3},
+			{0x3c6058e633063180, 0xbb42e906efb12540},
+			{0xbec40e0518086e21, 0x4e86f36c495eeedb},
+			{0x465276434fd98954, 0xe8345a7c487fefd6},
+			{0x3adaea5cdfe12e3b, 0x688b762874221434},
+			{0xc9dffa95904e99b1, 0x833801923a05f253},
+			{0xa10c3fb0b18df787, 0x58a00d23a8086646},
+			{0xa4e41f760281c3d0, 0xec69708d487dbfc4},
+			{0xb8880fff0e41261c, 0x47176f17de7ff0e9},
+			{0x58ee3b30f542767e, 0x4f40c533643920ea},
+			{0x15f2d25b60c5acd7, 0x83fd48d6b9620584},
+			{0xe448c83950a687ea, 0x0ce303c7d3aabbc8},
+			{0xa6ff7863c363cfd4, 0x1746715df0dd8fe3},
+			{0x7e9d8517b195d9c9, 0xc00185964caef8bb},
+			{0x40ddb4daf3fbdda8, 0xb6bde02bd004b144},
+			{0x7a794b820672a49b, 0xba43c63ec5a9f187},
+			{0xc1be31e7536236fb, 0x2467071b1d261621},
+			{0xf0eec34daea486fb, 0x5a6fc0435f011daa},
+			{0xf42c01a2a3815db4, 0xa5af34331c044d81},
+			{0xdf7964c343b312de, 0xdb43b553cd16ea44},
+			{0x8454182464c29903, 0x432c2bbcd03e65f6},
+			{0x7b6c0ecc6cb5adbb, 0xcdf56412d1e7ba6e},
+			{0x380b97764c9f7748, 0xac13c8b2ff838036},
+			{0x1868a9f5a4fd4d64, 0x71d208cc2e5c56e9},
+			{0xe89f5fe075d74a79, 0xd1d08a01b73de005},
+			{0x25aa87f3c2704c69, 0xa9495c12936ad0fd}};
+
+		/* Characteristic polynomial of the 128-bit `xoshiro` (4x32-bit state) transition, without the implicit leading term. */
+		inline constexpr std::uint32_t xoshiro128_charpoly[4] = {0xde18fc01, 0x1b489db6, 0x006254b1, 0x00fc65a2};
+		/* Jump polynomials `x^(2^i) mod charpoly` of the 128-bit `xoshiro` (4x32-bit state) transition. */
+		inline constexpr std::uint32_t xoshiro128_jmp_pow2[128][4] = {
+			{0x00000002, 0x00000000, 0x00000000, 0x00000000},
+			{0x00000004, 0x00000000, 0x00000000, 0x00000000},
+			{0x00000010, 0x00000000, 0x00000000, 0x00000000},
+			{0x00000100, 0x00000000, 0x00000000, 0x00000000},
+			{0x00010000, 0x00000000, 0x00000000, 0x00000000},
+			{0x00000000, 0x00000001, 0x00000000, 0x00000000},
+			{0x00000000, 0x00000000, 0x00000001, 0x00000000},
+			{0xde18fc01, 0x1b489db6, 0x006254b1, 0x00fc65a2},
+			{0x78bd1157, 0xb488a061, 0x77900a22, 0x0e6834fb},
+			{0x7b0bf49a, 0x4152f743, 0x44118d9b, 0x38d2b436},
+			{0x845a09b1, 0x94b54ba1, 0x503a9ae6, 0x5f7aa4ff},
+			{0x0a1f06b6, 0xece7bc8e, 0x9ab5cf0e, 0x780f1aed},
+			{0x8fcff8d3, 0xd66b4f59, 0x07ee277a, 0xeb3e4975},
+			{0x8a2979a9, 0x60e16970, 0x8b01ce7b, 0xc9d1ce32},
+			{0xd4fd7b86, 0x57b8e99a, 0x3853473d, 0xee6262e1},
+			{0x7f0861fd, 0xa1ea4d71, 0xa2327f56, 0x668140b3},
+			{0x08a24926, 0x2fb44195, 0x6d916ade, 0x4e271317},
+			{0xd35f6af2, 0x4677800b, 0x7b28f619, 0x83bc62cd},
+			{0x0dfcd277, 0x46325cc0, 0x73a74986, 0x19b1cec2},
+			{0xb8c5a6a6, 0x97e03957, 0xba0dcd4f, 0xee16f96c},
+			{0x584b12af, 0x7316a7cd, 0x7a2ba910, 0x53fe0a37},
+			{0x08b50aa9, 0x78f5b997, 0xb6319395, 0x665aaf09},
+			{0x2d6021ee, 0x4f64a1a4, 0x0baac402, 0x14dbe352},
+			{0xff5111ed, 0x8cdd10af, 0x9596864e, 0x7584f641},
+			{0x2e4b8d20, 0x6c4fa858, 0x60a23f97, 0x6cbdae97},
+			{0x8fd0c1ad, 0x8d6d396c, 0x1b2a88a9, 0x5409d06c},
+			{0x070bbd82, 0x38dc68d8, 0xe2f8cff2, 0x1a377633},
+			{0xdeef0ad1, 0x306d9b7b, 0x75f46cc6, 0x6ea3c8e6},
+			{0x3b11252c, 0x1849dfcf, 0x83608b0c, 0x4271354c},
+			{0x7bc67b5d, 0x699cac0a, 0xd888887f, 0x88e6db6e},
+			{0xdc16b5e8, 0x2514ba92, 0x5de9763f, 0x11534240},
+			{0x19a6c40d, 0xfdd2110d, 0x9499febc, 0x686d0878},
+			{0xf7afe108, 0xf3be07b8, 0x730b948d, 0x0f8aed94},
+			{0xf460532d, 0xc59fb123, 0xa69c31b0, 0x5322c76e},
+			{0x51e478c4, 0xf5e2f2d7, 0xfe9852d5, 0x95e92935},
+			{0xb50d1e24, 0xb42d61cd, 0xbd400cdd, 0x09d372b1},
+			{0x6bdfad84, 0xc4c77b39, 0x2c1d0568, 0xe7536e87},
+			{0x1971c861, 0x9b2f7d00, 0x5bfabd1e, 0x4b9d0a59},
+			{0xfa529189, 0x29d8e7c8, 0x6e84af09, 0xd61683d9},
+			{0xafa34e18, 0x990b180c, 0x93d1a9a8, 0x2bddc822},
+			{0x4690ac90, 0x83f99607, 0x720d8d54, 0x8c913c7b},
+			{0x369ee447, 0xb2090283, 0x4e01096b, 0x5bcc6a1a},
+			{0x5bdef343, 0x1b6400d1, 0xe94b6db2, 0x789925e5},
+			{0x24768a59, 0x298bd3d0, 0x17709585, 0x44b170cf},
+			{0x5d874f1b, 0x170214ce, 0x0b14099d, 0x97cda294},
+			{0xe0d94af5, 0x53f78198, 0xf13a78ac, 0x48731cb9},
+			{0xccca1be5, 0xa64a2fb8, 0xe4558a6e, 0x3f16f673},
+			{0x0683f257, 0x6dd6ee27, 0x99a8d18e, 0xa3ef88df},
+			{0xcb56667c, 0x87a4583d, 0xdec5bb9a, 0xdeaa4ca2},
+			{0xcfa23a11, 0xf03580b0, 0x76e2536b, 0x8c8fab83},
+			{0xb6ff34b1, 0x16f8a8c8, 0x445b421d, 0x6157c701},
+			{0x4ec6d5de, 0x4cf8b920, 0x7e968b3e, 0xc9790225},
+			{0x35a81e7c, 0x3b0ce3bf, 0xc4c741e4, 0xdbcbeaae},
+			{0x816402f4, 0x1970e372, 0x8b80bd92, 0x479e43a8},
+			{0xddeca818, 0xc45c3501, 0x2253cc65, 0x0adcea84},
+			{0x729a959b, 0x880a3b77, 0x4de1459a, 0xb1afc783},
+			{0x61fb9420, 0xe6895754, 0x2f656668, 0x5d351d8e},
+			{0x09e626b1, 0xed521e9b, 0x48307882, 0x1f945c5f},
+			{0x7e887a38, 0x6247b9b1, 0xab5076c6, 0x8f5e8e11},
+			{0xc815942d, 0x3bef9fbe, 0x163b81db, 0xdd9db375},
+			{0x556b1be1, 0x570b130f, 0xef247f68, 0x81a138ad},
+			{0x744853a3, 0x485c1e3e, 0xae1e2311, 0x2ca9fb49},
+			{0x1615188d, 0x821fd395, 0xf2c0b4f8, 0x3e3e7fb3},
+			{0xfbb4ea2a, 0x0c437163, 0xeeeeff2f, 0xce994be3},
+			{0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b},
+			{0x9b802a8b, 0x794805ed, 0x5eb170f0, 0x7c0f7916},
+			{0x1a235895, 0x008078d6, 0x18eca90e, 0x5f292782},
+			{0xf70585fb, 0x4e0c5957, 0xbce250c3, 0x17a896ff},
+			{0xd2f6556f, 0x4a18286d, 0x3628d30b, 0x55160319},
+			{0x7a7faf9a, 0xa16bbafd, 0x0e0ce4fb, 0x3c7d15de},
+			{0xf28e46eb, 0x5de8d870, 0x99c73881, 0x138475d2},
+			{0x606a7785, 0x20e6d45f, 0x1b647514, 0x86eb7ca9},
+			{0x49666ecc, 0x3789d8a5, 0x6a660a93, 0xd71038c4},
+			{0x5128e049, 0x57728e18, 0x914d8f82, 0x770b4aae},
+			{0xf4c220b9, 0x204509e7, 0xf72abaa8, 0x87a9ba17},
+			{0xa770745c, 0x6305aeb1, 0x514fb641, 0x53f14381},
+			{0xef0c0748, 0x37c6bfd3, 0xce823c5f, 0x614b1be8},
+			{0xa7598b6e, 0x56acc333, 0x7616abeb, 0x444c7482},
+			{0x3b8e5872, 0x95b59666, 0x250a934e, 0xe1c8cd14},
+			{0x61af734b, 0xcafb7bef, 0x40320995, 0x52c3fefd},
+			{0x1e448b65, 0x3d04f456, 0x0065b6c1, 0x03ede698},
+			{0x999c0c61, 0x8f514f34, 0x208ae8a1, 0xa286055d},
+			{0xfd77b051, 0xdc74937c, 0x87c9caa7, 0x87c3b447},
+			{0x5cb18704, 0x3861888c, 0x421e95f0, 0x84702775},
+			{0x796e8f1c, 0x17386578, 0xa950e8b9, 0x5122b999},
+			{0xfd714f38, 0x6a60580c, 0x1de92dc7, 0x0a378a8d},
+			{0x920394a9, 0x59e5f42e, 0xa82afdb9, 0x29ec5ed3},
+			{0x9d4e636e, 0x91c22db3, 0xf24479f8, 0xb34270ee},
+			{0xf610cdc8, 0x935a2512, 0xa972efe6, 0x866bc548},
+			{0xf67e06e0, 0x830fc62f, 0x426d33f9, 0x36c311b2},
+			{0x82e394f4, 0x8e7ae190, 0x74da71b9, 0x2b8b3ac4},
+			{0x1b17a73e, 0x48ec363c, 0x9f3a8665, 0x1ba09ec7},
+			{0x5eee0d0e, 0x8a54b514, 0x268d5b56, 0x7c53cf77},
+			{0xecb31e06, 0x1def52d6, 0x5ec53d4f, 0xcb831ed8},
+			{0x196075bf, 0xc31db8fb, 0x2e624b60, 0xba7e0917},
+			{0xf59f8398, 0x7e8f6a86, 0xc9ba6afb, 0xc28a81ed},
+			{0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662},
+			{0xeeb0e0a4, 0x77133e23, 0xdc596025, 0x97f55fe2},
+			{0x9e9b45ac, 0x6d495900, 0x69ac41e5, 0x0356e935},
+			{0x407883f3, 0x547d4854, 0x9065599b, 0x662b6ac9},
+			{0x667ee2de, 0x8a954d8b, 0x6551c593, 0x2fcdf7e4},
+			{0xfb5707aa, 0xdaa2886a, 0xb233cd67, 0x0f4183ca},
+			{0x40dbcd63, 0x8e131a4f, 0x224fc251, 0xc64784ee},
+			{0x4f4db4ff, 0x7b6ea15f, 0xb29e13b7, 0x563b1ea7},
+			{0xbbd3ae5a, 0xebf544e9, 0xd28ec540, 0x5ce3332f},
+			{0xd39c61eb, 0x1f4dd02e, 0x95a4e90f, 0xa9ac90e8},
+			{0x790c846c, 0xd428b915, 0xd2660f23, 0x725dcd70},
+			{0x08eff263, 0xf39ff6c1, 0x513d8ba0, 0xca4404ca},
+			{0x26534b4d, 0xcf8db66b, 0x6102f64b, 0xf84f07e3},
+			{0xa88724c5, 0x0870d7d7, 0x181f9787, 0xdc3d5d45},
+			{0xdba73489, 0x0df0ec1f, 0x43005e2e, 0xd543edf1},
+			{0x6d73a1e7, 0xfe43b2a7, 0xf9a46a20, 0x58859a86},
+			{0xa683b6d0, 0xafc4a733, 0x1bf94979, 0xf904dd9f},
+			{0x2ee03d84, 0x75c74e3d, 0x96efbfd6, 0x7d256f6c},
+			{0x3ad0ebe7, 0x13f14f31, 0x796d291c, 0xa42bbfdd},
+			{0xce04ddb0, 0x1fc44a96, 0xb6a00a91, 0x8a6c4326},
+			{0x4e519967, 0x0d7a869e, 0x40012492, 0x6dc7c036},
+			{0x9e4d0a48, 0x6a86db67, 0xae852b9b, 0x6cc51ceb},
+			{0x5a52e97f, 0x77beacce, 0xb8030b6c, 0x5ead7c39},
+			{0x022cefbe, 0x7d88e3d4, 0x858bbdfe, 0x6b644146},
+			{0x90067a45, 0xb7ce03bc, 0xde4ac3e8, 0x99853a2c},
+			{0xe3a7ccf3, 0x35c9b163, 0xbb5b8048, 0x31ac55d8},
+			{0x8d4a33db, 0x169e96ef, 0x3788b4a3, 0x622cd32e},
+			{0x0513f190, 0x06f60339, 0x93608184, 0x4576959d},
+			{0x1a64167b, 0x05c745c5, 0xe2f50d3a, 0x8abc30fa},
+			{0x1741bb62, 0x3afd4ba4, 0xb268faef, 0x18bf57c6},
+			{0x39b7b7b9, 0x31bb1001, 0xd95f2dcc, 0x5686c6e7},
+			{0x54d81f7e, 0x0453f0fe, 0x3bef4345, 0x9d5e1791}};
+
+		/* Multiplies GF(2) polynomials `a` and `b` modulo the characteristic polynomial `c` and writes the result to `a`. */
+		template<typename U, std::size_t K>
+		constexpr void jump_poly_mul(U (&a)[K], const U (&b)[K], const U (&c)[K]) noexcept
+		{
+			constexpr auto digits = std::numeric_limits<U>::digits;
+
+			U r[K] = {}, x[K];
+			std::copy_n(a, K, x);
+			for (std::size_t i = 0; i < K * digits; ++i)
+			{
+				if ((b[i / digits] >> (i % digits)) & 1)
+					for (std::size_t j = 0; j < K; ++j) r[j] ^= x[j];
+
+				/* x = x * X mod c */
+				const auto carry = x[K - 1] >> (digits - 1);
+				for (std::size_t j = K - 1; j > 0; --j) x[j] = static_cast<U>(x[j] << 1) | (x[j - 1] >> (digits - 1));
+				x[0] = static_cast<U>(x[0] << 1);
+				if (carry) for (std::size_t j = 0; j < K; ++j) x[j] ^= c[j];
+			}
+			std::copy_n(r, K, a);
+		}
+		/* Assembles the jump polynomial `x^n mod c` for the 128-bit distance `n = hi * 2^64 + lo` from table `pow2` of `x^(2^i) mod c`
+		 * and writes it to `out`. */
+		template<typename U, std::size_t K>
+		constexpr void jump_poly(std::uint64_t hi, std::uint64_t lo, const U (&pow2)[128][K], const U (&c)[K], U (&out)[K]) noexcept
+		{
+			std::fill_n(out, K, U{0});
+			out[0] = 1;
+			for (std::size_t i = 0; lo != 0; ++i, lo >>= 1)
+				if (lo & 1) jump_poly_mul(out, pow2[i], c);
+			for (std::size_t i = 64; hi != 0; ++i, hi >>= 1)
+				if (hi & 1) jump_poly_mul(out, pow2[i], c);
+		}
+		/* Raises jump polynomial `p` to power `n` modulo `c` and writes the result to `out`. */
+		template<typename U, std::size_t K>
+		constexpr void jump_poly_pow(const U (&p)[K], std::size_t n, const U (&c)[K], U (&out)[K]) noexcept
+		{
+			U base[K];
+			std::copy_n(p, K, base);
+			std::fill_n(out, K, U{0});
+			out[0] = 1;
+			for (; n != 0; n >>= 1)
+			{
+				if (n & 1) jump_poly_mul(out, base, c);
+				if (n > 1) jump_poly_mul(base, base, c);
+			}
+		}
+	}
+}
@@ -0,0 +1,93 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include <atomic>
+
+#include "xoroshiro.hpp"
+
+namespace sek
+{
+	/** @brief Registry of non-overlapping `xoroshiro` random number streams derived from a single root seed.
+	 *
+	 * Stream `i` is the root engine advanced by `i` jumps, so streams of different indices never overlap and are
+	 * reproducible from the root seed alone. Registries may additionally be partitioned via long jumps of the root engine.
+	 *
+	 * @tparam T Type generated by the engines. Supported types: std::uint64_t, std::uint32_t, double, float.
+	 * @tparam Width Width of the internal state. Supported values: 256 (std::uint64_t & double only), 128. */
+	template<typename T, std::size_t Width = 256>
+	class xoroshiro_registry
+	{
+	public:
+		using engine_type = xoroshiro<T, Width>;
+		using seed_type = typename engine_type::seed_type;
+
+	private:
+		/* Engines of the calling thread keyed by registry id. Map nodes are stable, so references returned
+		 * by `local` stay valid while other registries insert their own engines. */
+		[[nodiscard]] static std::unordered_map<std::uint64_t, engine_type> &local_storage() noexcept
+		{
+			thread_local std::unordered_map<std::uint64_t, engine_type> engines;
+			return engines;
+		}
+		[[nodiscard]] static std::uint64_t next_id() noexcept
+		{
+			static std::atomic<std::uint64_t> id = 0;
+			return id.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+	public:
+		xoroshiro_registry(const xoroshiro_registry &) = delete;
+		xoroshiro_registry &operator=(const xoroshiro_registry &) = delete;
+
+		/** Initializes the registry from a root engine \a root. */
+		explicit xoroshiro_registry(const engine_type &root) noexcept : m_root(root), m_id(next_id()) {}
+		/** Initializes the registry from a root seed \a seed.
+		 * @param partition Number of long jumps applied to the root engine. Registries of different partitions never overlap. */
+		explicit xoroshiro_registry(seed_type seed, std::size_t partition = 0) noexcept : m_root(seed), m_id(next_id()) { m_root.long_jump(partition); }
+		/** Releases the engine of the calling thread.
+		 * @note Engines of other threads are released when the respective thread exits. */
+		~xoroshiro_registry() { local_storage().erase(m_id); }
+
+		/** Returns the root engine of the registry. */
+		[[nodiscard]] constexpr const engine_type &root() const noexcept { return m_root; }
+
+		/** Returns engine of the `i`th stream. Equivalent to the root engine advanced by \a i jumps. */
+		[[nodiscard]] engine_type stream(std::size_t i) const noexcept
+		{
+			auto result = m_root;
+			result.jump(i);
+			return result;
+		}
+
+		/** Returns reference to the engine of the calling thread. On first use from a thread, the engine is initialized
+		 * from the next unused stream index. Subsequent calls from the same thread return the same engine and do not synchronize.
+		 * @note Streams are assigned in the order of first use, which is only reproducible if threads are started in a fixed order.
+		 * Use `local(i)` for a fixed thread-to-stream mapping. */
+		[[nodiscard]] engine_type &local()
+		{
+			auto &engines = local_storage();
+			if (const auto iter = engines.find(m_id); iter != engines.end()) [[likely]]
+				return iter->second;
+			return engines.emplace(m_id, stream(m_next.fetch_add(1, std::memory_order_relaxed))).first->second;
+		}
+		/** Returns reference to the engine of the calling thread. On first use from a thread, the engine is initialized
+		 * from stream \a i. Subsequent calls from the same thread return the same engine and ignore \a i.
+		 * @note Indices passed to `local(i)` are not reserved from `local()`, mixing the two may assign the same stream to different threads. */
+		[[nodiscard]] engine_type &local(std::size_t i)
+		{
+			auto &engines = local_storage();
+			if (const auto iter = engines.find(m_id); iter != engines.end()) [[likely]]
+				return iter->second;
+			return engines.emplace(m_id, stream(i)).first->second;
+		}
+
+	private:
+		engine_type m_root;
+		std::uint64_t m_id;
+		std::atomic<std::size_t> m_next = 0;
+	};
+}
@@ -0,0 +1,201 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include "type_vec.hpp"
+#include "xoroshiro.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		template<std::size_t K, typename T, std::size_t N, typename A>
+		[[nodiscard]] SEK_FORCEINLINE basic_vec<T, N, A> vec_rotl(const basic_vec<T, N, A> &x) noexcept
+		{
+			return (x << T{K}) | (x >> T{std::numeric_limits<T>::digits - K});
+		}
+	}
+
+	/** @brief Multi-lane `xoroshiro` random number engine.
+	 *
+	 * Keeps `Lanes` interleaved states of the scalar `xoroshiro<T, Width>` engine in SIMD vectors and advances all of
+	 * them in parallel, producing a full vector of random numbers per step. Lane states are initialized from a single seed,
+	 * where every consecutive lane is advanced by one `jump()` from the previous one, so that sequences of the individual
+	 * lanes do not overlap.
+	 *
+	 * @tparam T Type generated by the engine. Supported types: std::uint64_t, std::uint32_t, double, float.
+	 * @tparam Width Width of the internal state. Supported values: 256 (std::uint64_t & double only), 128.
+	 * @tparam Lanes Number of parallel states (and size of the result vector). */
+	template<typename T, std::size_t Width, std::size_t Lanes = math_abi::abi_tag_size_v<T, math_abi::native<T>>>
+	class xoroshiro_simd
+	{
+		template<typename>
+		friend struct serial_traits;
+
+		using scalar_t = xoroshiro<T, Width>;
+		using scalar_state_t = typename detail::impl_xoroshiro<T, Width>::state_type;
+
+		constexpr static std::size_t state_size = std::extent_v<scalar_state_t>;
+
+	public:
+		using seed_type = typename scalar_t::seed_type;
+		using state_vec_type = vec<seed_type, Lanes>;
+		using result_type = vec<T, Lanes>;
+
+		/** Returns the number of parallel states of the engine. */
+		[[nodiscard]] constexpr static std::size_t lanes() noexcept { return Lanes; }
+
+	public:
+		/** Initializes the generator to a default state. */
+		xoroshiro_simd() noexcept { seed(); }
+		/** Initializes the generator from a user-specified seed. */
+		explicit xoroshiro_simd(seed_type s) noexcept { seed(s); }
+		/** Initializes the generator from a seed sequence. */
+		template<detail::seed_generator<seed_type> S>
+		explicit xoroshiro_simd(S &s) noexcept { seed(s); }
+		/** Initializes lanes of the generator from scalar engine \a g. Lane `i` is set to the state of \a g advanced by `i` jumps. */
+		explicit xoroshiro_simd(scalar_t g) noexcept { seed(g); }
+
+		/** Seeds the generator with a default seed. */
+		void seed() noexcept { seed(scalar_t{}); }
+		/** Seeds the generator with an user-specified seed. */
+		void seed(seed_type s) noexcept { seed(scalar_t{s}); }
+		/** Seeds the generator with a seed sequence. */
+		template<detail::seed_generator<seed_type> S>
+		void seed(S &s) noexcept { seed(scalar_t{s}); }
+		/** Seeds lanes of the generator from scalar engine \a g. Lane `i` is set to the state of \a g advanced by `i` jumps. */
+		void seed(scalar_t g) noexcept
+		{
+			for (std::size_t i = 0; i < Lanes; ++i, g.jump())
+				for (std::size_t j = 0; j < state_size; ++j) m_state[j][i] = g.state()[j];
+		}
+
+		/** Returns the scalar engine of the `i`th lane.
+		 * @throw std::range_error In case \a i exceeds `lanes()`. */
+		[[nodiscard]] scalar_t lane(std::size_t i) const
+		{
+			if (i >= Lanes) [[unlikely]] throw std::range_error("Lane index out of range");
+
+			scalar_t result;
+			for (std::size_t j = 0; j < state_size; ++j) result.state()[j] = m_state[j][i];
+			return result;
+		}
+
+		/** Returns the next vector of random numbers. Element `i` of the result is the next random number of lane `i`. */
+		result_type next() noexcept
+		{
+			if constexpr (state_size == 2)
+				return next_xoroshiro();
+			else
+				return next_xoshiro();
+		}
+		/** @copydoc next */
+		result_type operator()() noexcept { return next(); }
+
+		/** Advances every lane of the generator by `n`.
+		 * @note Distances exceeding `Width` are advanced via a jump polynomial, which requires at most `Width` steps. */
+		void discard(std::size_t n) noexcept { discard(0, n); }
+		/** Advances every lane of the generator by the 128-bit distance `hi * 2^64 + lo`.
+		 * @note Distances exceeding `Width` are advanced via a jump polynomial, which requires at most `Width` steps. */
+		void discard(std::uint64_t hi, std::uint64_t lo) noexcept
+		{
+			if (hi != 0 || lo > Width)
+			{
+				scalar_state_t poly = {};
+				detail::jump_poly(hi, lo, scalar_t::jmp_pow2, scalar_t::charpoly, poly);
+				do_jump(poly);
+			}
+			else
+				while (lo-- > 0) step();
+		}
+
+		/** Advances every lane of the generator by the same amount as `xoroshiro<T, Width>::jump`. */
+		void jump() noexcept { do_jump(scalar_t::jmp_short); }
+		/** Advances every lane of the generator by the same amount as `xoroshiro<T, Width>::long_jump`. */
+		void long_jump() noexcept { do_jump(scalar_t::jmp_long); }
+
+		[[nodiscard]] bool operator==(const xoroshiro_simd &other) const noexcept
+		{
+			for (std::size_t j = 0; j < state_size; ++j)
+				if (!all_of(m_state[j] == other.m_state[j])) return false;
+			return true;
+		}
+
+	private:
+		/* xoshiro256 & xoshiro128 (4-word state) step. */
+		SEK_FORCEINLINE result_type next_xoshiro() noexcept
+		{
+			constexpr std::size_t digits = std::numeric_limits<seed_type>::digits;
+			constexpr std::size_t shift = digits == 64 ? 17 : 9;
+			constexpr std::size_t rot = digits == 64 ? 45 : 11;
+
+			auto &s = m_state;
+			state_vec_type result;
+			if constexpr (std::integral<T>)
+				result = detail::vec_rotl<7>(s[1] * state_vec_type{5}) * state_vec_type{9};
+			else
+				result = s[0] + s[3];
+			const auto tmp = s[1] << seed_type{shift};
+
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+
+			s[2] ^= tmp;
+			s[3] = detail::vec_rotl<rot>(s[3]);
+
+			if constexpr (std::integral<T>)
+				return result;
+			else
+				return detail::vec_bits_to_unit<T>(result);
+		}
+		/* xoroshiro128 (2-word state) step. */
+		SEK_FORCEINLINE result_type next_xoroshiro() noexcept
+		{
+			const auto s0 = m_state[0];
+			auto s1 = m_state[1];
+
+			state_vec_type result;
+			if constexpr (std::integral<T>)
+				result = detail::vec_rotl<7>(s0 * state_vec_type{5}) * state_vec_type{9};
+			else
+				result = s0 + s1;
+
+			s1 ^= s0;
+			m_state[0] = detail::vec_rotl<24>(s0) ^ s1 ^ (s1 << seed_type{16});
+			m_state[1] = detail::vec_rotl<37>(s1);
+
+			if constexpr (std::integral<T>)
+				return result;
+			else
+				return detail::vec_bits_to_unit<T>(result);
+		}
+		SEK_FORCEINLINE void step() noexcept { static_cast<void>(next()); }
+
+		void do_jump(const scalar_state_t &jmp_arr) noexcept
+		{
+			/* Jump polynomial is the same for every lane, so bits are tested once and the state XOR is done for all lanes at once. */
+			state_vec_type tmp[state_size] = {};
+			for (auto jmp: jmp_arr)
+				for (std::size_t b = 0; b < std::numeric_limits<seed_type>::digits; ++b)
+				{
+					if (jmp & static_cast<seed_type>(1) << b)
+						for (std::size_t j = 0; j < state_size; ++j) tmp[j] ^= m_state[j];
+					step();
+				}
+			std::copy_n(tmp, state_size, m_state);
+		}
+
+		state_vec_type m_state[state_size];
+	};
+
+	/** 128-bit alias for the multi-lane xoroshiro random number generator. */
+	template<typename T, std::size_t Lanes = math_abi::abi_tag_size_v<T, math_abi::native<T>>>
+	using xoroshiro128_simd = xoroshiro_simd<T, 128, Lanes>;
+	/** 256-bit alias for the multi-lane xoroshiro random number generator. */
+	template<typename T, std::size_t Lanes = math_abi::abi_tag_size_v<T, math_abi::native<T>>>
+	using xoroshiro256_simd = xoroshiro_simd<T, 256, Lanes>;
+}
@@ -0,0 +1,247 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "quaternion.hpp"
+
+namespace sek
+{
+	/** @brief Structure used to define a dual quaternion.
+	 *
+	 * Unit dual quaternions represent rigid (rotation and translation) transforms using 8 components.
+	 * The real part stores the rotation, while the dual part stores the translation as `0.5 * t * r`.
+	 *
+	 * @tparam T Value type stored by the dual quaternion.
+	 * @tparam Abi ABI tag used for the underlying storage of the dual quaternion.
+	 * @note The \a Abi tag size must be `4`. */
+	template<std::floating_point T, typename Abi>
+	class basic_dual_quat
+	{
+	public:
+		using quat_type = basic_quat<T, Abi>;
+		using vector_type = basic_vec<T, 4, Abi>;
+		using value_type = typename quat_type::value_type;
+
+		/** Returns identity dual quaternion. */
+		[[nodiscard]] static basic_dual_quat identity() noexcept { return {quat_type{T{0}, T{0}, T{0}, T{1}}, quat_type{T{0}, T{0}, T{0}, T{0}}}; }
+
+	public:
+		/** Initializes a null (zero) dual quaternion. */
+		constexpr basic_dual_quat() noexcept = default;
+
+		/** Initializes the dual quaternion from a real part \a r and a dual part \a d. */
+		constexpr basic_dual_quat(const quat_type &r, const quat_type &d) noexcept : m_real(r), m_dual(d) {}
+		/** Initializes the dual quaternion from a normalized rotation \a r and translation vector \a t. */
+		template<typename A>
+		basic_dual_quat(const quat_type &r, const basic_vec<T, 3, A> &t) noexcept : m_real(r), m_dual(quat_type{t, T{0}} * r)
+		{
+			m_dual = m_dual.vector() * T{0.5};
+		}
+		/** Initializes the dual quaternion from a rigid 4x4 transform matrix.
+		 * @note The linear part of \a m must be orthonormal. */
+		template<typename A>
+		explicit basic_dual_quat(const basic_mat<T, 4, 4, A> &m) noexcept : basic_dual_quat(quat_type{m}, m[3].xyz()) {}
+
+		/** Returns reference to the real (rotation) part of the dual quaternion. */
+		[[nodiscard]] constexpr quat_type &real() noexcept { return m_real; }
+		/** Returns copy of the real (rotation) part of the dual quaternion. */
+		[[nodiscard]] constexpr const quat_type &real() const noexcept { return m_real; }
+		/** Returns reference to the dual part of the dual quaternion. */
+		[[nodiscard]] constexpr quat_type &dual() noexcept { return m_dual; }
+		/** Returns copy of the dual part of the dual quaternion. */
+		[[nodiscard]] constexpr const quat_type &dual() const noexcept { return m_dual; }
+
+		/** Returns the rotation of the dual quaternion. */
+		[[nodiscard]] constexpr const quat_type &rotation() const noexcept { return m_real; }
+		/** Returns the translation of the dual quaternion. */
+		[[nodiscard]] vec3<T, Abi> translation() const noexcept { return (m_dual * conjugate(m_real)).vector().xyz() * T{2}; }
+
+		/** Converts the dual quaternion to a 4x4 rigid transform matrix. */
+		template<typename A>
+		[[nodiscard]] explicit operator basic_mat<T, 4, 4, A>() const noexcept
+		{
+			basic_mat<T, 4, 4, A> result = basic_mat<T, 4, 4, A>{m_real};
+			result[3] = basic_vec<T, 4, A>{translation(), T{1}};
+			return result;
+		}
+
+	private:
+		quat_type m_real;
+		quat_type m_dual;
+	};
+
+#pragma region "basic_dual_quat aliases"
+	/** Alias for dual quaternion that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<4>>
+	using dual_quat = basic_dual_quat<T, math_abi::deduce_t<T, 4, Abi>>;
+	/** Alias for dual quaternion that uses implementation-defined compatible ABI. */
+	template<typename T>
+	using compat_dual_quat = basic_dual_quat<T, math_abi::deduce_t<T, 4, math_abi::compatible<T>>>;
+	/** Alias for dual quaternion that uses packed (non-vectorized) ABI. */
+	template<typename T>
+	using packed_dual_quat = basic_dual_quat<T, math_abi::packed_buffer<4>>;
+#pragma endregion
+
+#pragma region "basic_dual_quat operators"
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator-(const basic_dual_quat<T, Abi> &x) noexcept { return {-x.real(), -x.dual()}; }
+
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator+(const basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept { return {a.real() + b.real(), a.dual() + b.dual()}; }
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator-(const basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept { return {a.real() - b.real(), a.dual() - b.dual()}; }
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator*(const basic_dual_quat<T, Abi> &a, T b) noexcept { return {a.real().vector() * b, a.dual().vector() * b}; }
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator*(T a, const basic_dual_quat<T, Abi> &b) noexcept { return b * a; }
+
+	/** Composes dual quaternions \a a and \a b. The resulting transform applies \a b first, then \a a. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> operator*(const basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept
+	{
+		return {a.real() * b.real(), a.real() * b.dual() + a.dual() * b.real()};
+	}
+	template<typename T, typename Abi>
+	inline basic_dual_quat<T, Abi> &operator*=(basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept { return a = a * b; }
+
+	template<typename T, typename Abi>
+	[[nodiscard]] inline bool operator==(const basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept { return all_of(a.real() == b.real()) && all_of(a.dual() == b.dual()); }
+	template<typename T, typename Abi>
+	[[nodiscard]] inline bool operator!=(const basic_dual_quat<T, Abi> &a, const basic_dual_quat<T, Abi> &b) noexcept { return !(a == b); }
+#pragma endregion
+
+#pragma region "basic_dual_quat functions"
+	/** Calculates the conjugate (quaternion conjugate of both parts) of dual quaternion \a x. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> conjugate(const basic_dual_quat<T, Abi> &x) noexcept { return {conjugate(x.real()), conjugate(x.dual())}; }
+	/** Calculates the inverse of a unit dual quaternion \a x.
+	 * @note Result is undefined if \a x is not normalized. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> inverse(const basic_dual_quat<T, Abi> &x) noexcept { return conjugate(x); }
+
+	/** Returns the normalized copy of dual quaternion \a x.
+	 * Normalization scales both parts by the inverse magnitude of the real part and makes the dual part orthogonal to the real part. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> normalize(const basic_dual_quat<T, Abi> &x) noexcept
+	{
+		const auto dp = dot(x.real(), x.real());
+		if (dp <= std::numeric_limits<T>::epsilon()) [[unlikely]]
+			return basic_dual_quat<T, Abi>::identity();
+
+		const auto k = detail::rsqrt(dp);
+		const auto r = x.real().vector() * k;
+		const auto d = x.dual().vector() * k;
+		return {r, fnmadd(r, {dot(r, d)}, d)};
+	}
+
+	/** Transforms point \a v by unit dual quaternion \a x. */
+	template<typename T, typename Abi, typename A>
+	[[nodiscard]] inline basic_vec<T, 3, A> transform_point(const basic_dual_quat<T, Abi> &x, const basic_vec<T, 3, A> &v) noexcept { return x.real() * v + basic_vec<T, 3, A>{x.translation()}; }
+	/** Transforms direction \a v by unit dual quaternion \a x. */
+	template<typename T, typename Abi, typename A>
+	[[nodiscard]] inline basic_vec<T, 3, A> transform_direction(const basic_dual_quat<T, Abi> &x, const basic_vec<T, 3, A> &v) noexcept { return x.real() * v; }
+
+	/** Blends dual quaternions \a dq using weights \a w via dual-quaternion linear blending (DLB).
+	 * Dual quaternions are aligned to the hemisphere of the first one with non-zero weight before blending, and the result is normalized.
+	 * @note \a dq and \a w must be of the same size. */
+	template<typename T, typename Abi>
+	[[nodiscard]] inline basic_dual_quat<T, Abi> dlb(std::span<const basic_dual_quat<T, Abi>> dq, std::span<const T> w) noexcept
+	{
+		SEK_ASSERT(dq.size() == w.size());
+
+		std::size_t p = 0;
+		while (p < w.size() && w[p] == T{0}) ++p;
+		if (p == w.size()) [[unlikely]] return basic_dual_quat<T, Abi>::identity();
+
+		auto result = dq[p] * w[p];
+		for (std::size_t i = p + 1; i < dq.size(); ++i)
+		{
+			const auto k = dot(dq[p].real(), dq[i].real()) < T{0} ? -w[i] : w[i];
+			result = result + dq[i] * k;
+		}
+		return normalize(result);
+	}
+
+	/** Blends up to 4 bone dual quaternions per vertex using dual-quaternion linear blending and writes the results to \a out.
+	 * Vertices are processed in blocks of `native_vec<T>::size()`, with hemisphere alignment and normalization selected per-lane via masks.
+	 * @param bones Dual quaternions of the bones.
+	 * @param idx Bone indices of the influences of every vertex.
+	 * @param w Weights of the influences of every vertex. Influences with zero weight are ignored, including for the selection
+	 * of the hemisphere pivot, which is the first influence with non-zero weight.
+	 * @param out Span receiving blended dual quaternions. Must be at least `idx.size()` elements long.
+	 * @note \a idx and \a w must be of the same size, and all indices must be less than `bones.size()`. */
+	template<typename T, typename Abi, typename AI, typename AW>
+	inline void dlb_batch(std::span<const basic_dual_quat<T, Abi>> bones, std::span<const basic_vec<std::uint32_t, 4, AI>> idx, std::span<const basic_vec<T, 4, AW>> w,
+	                      std::span<basic_dual_quat<T, Abi>> out) noexcept
+	{
+		using lane_t = native_vec<T>;
+		constexpr auto lw = lane_t{}.size();
+		constexpr auto align = alignof(typename lane_t::simd_type);
+
+		SEK_ASSERT(idx.size() == w.size() && out.size() >= idx.size());
+
+		alignas(align) T buff[9][lw];
+		for (std::size_t i = 0; i < idx.size(); i += lw)
+		{
+			const auto n = std::min(lw, idx.size() - i);
+			if (n < lw) [[unlikely]] std::fill_n(&buff[0][0], 9 * lw, T{0});
+
+			/* Pivot of a lane is selected from the first influence with non-zero weight, lanes without a pivot keep it zeroed. */
+			lane_t acc[8], pivot[4];
+			std::fill_n(acc, 8, lane_t{T{0}});
+			std::fill_n(pivot, 4, lane_t{T{0}});
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				/* Gather the `j`th influence of every vertex in the block. */
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					const auto &dq = bones[idx[i + k][j]];
+					for (std::size_t c = 0; c < 4; ++c)
+					{
+						buff[c][k] = dq.real()[c];
+						buff[c + 4][k] = dq.dual()[c];
+					}
+					buff[8][k] = w[i + k][j];
+				}
+
+				lane_t q[8], wj;
+				for (std::size_t c = 0; c < 8; ++c) to_simd(q[c]).copy_from(buff[c], dpm::vector_aligned);
+				to_simd(wj).copy_from(buff[8], dpm::vector_aligned);
+
+				const auto pn = fmadd(pivot[0], pivot[0], fmadd(pivot[1], pivot[1], fmadd(pivot[2], pivot[2], pivot[3] * pivot[3])));
+				const auto take = pn == lane_t{T{0}} && wj != lane_t{T{0}};
+				for (std::size_t c = 0; c < 4; ++c) pivot[c] = blend(pivot[c], q[c], take);
+
+				const auto dp = fmadd(pivot[0], q[0], fmadd(pivot[1], q[1], fmadd(pivot[2], q[2], pivot[3] * q[3])));
+				wj = blend(wj, -wj, dp < lane_t{T{0}});
+				for (std::size_t c = 0; c < 8; ++c) acc[c] = fmadd(q[c], wj, acc[c]);
+			}
+
+			/* Normalize the blended dual quaternions. */
+			const auto dp = fmadd(acc[0], acc[0], fmadd(acc[1], acc[1], fmadd(acc[2], acc[2], acc[3] * acc[3])));
+			const auto degenerate = dp <= lane_t{std::numeric_limits<T>::epsilon()};
+			const auto k = blend(lane_t{T{1}} / sqrt(dp), lane_t{T{0}}, degenerate);
+			for (std::size_t c = 0; c < 8; ++c) acc[c] *= k;
+			const auto rd = fmadd(acc[0], acc[4], fmadd(acc[1], acc[5], fmadd(acc[2], acc[6], acc[3] * acc[7])));
+			for (std::size_t c = 0; c < 4; ++c) acc[c + 4] = fnmadd(acc[c], rd, acc[c + 4]);
+			/* Degenerate lanes are zeroed above, select identity for them same as `normalize`. */
+			acc[3] = blend(acc[3], lane_t{T{1}}, degenerate);
+
+			for (std::size_t c = 0; c < 8; ++c) to_simd(acc[c]).copy_to(buff[c], dpm::vector_aligned);
+			for (std::size_t k = 0; k < n; ++k)
+			{
+				auto &dq = out[i + k];
+				for (std::size_t c = 0; c < 4; ++c)
+				{
+					dq.real()[c] = buff[c][k];
+					dq.dual()[c] = buff[c + 4][k];
+				}
+			}
+		}
+	}
+#pragma endregion
+}
@@ -0,0 +1,313 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <functional>
+#include <ranges>
+#include <tuple>
+#include <span>
+
+#include "vector.hpp"
+
+namespace sek
+{
+	template<typename E>
+	class vec_expr;
+
+	namespace detail
+	{
+		template<typename>
+		struct is_vec_expr : std::false_type {};
+		template<typename E>
+		struct is_vec_expr<vec_expr<E>> : std::true_type {};
+
+		template<typename>
+		struct is_expr_vec : std::false_type {};
+		template<typename T, std::size_t N, typename A>
+		struct is_expr_vec<basic_vec<T, N, A>> : std::true_type {};
+
+		/* Element types of expression terminals. */
+		template<typename V>
+		concept expr_element = std::is_arithmetic_v<V> || is_expr_vec<V>::value;
+		/* Operands of expression operators & functions. At least one of the operands must be an expression. */
+		template<typename X>
+		concept expr_operand = is_vec_expr<X>::value || expr_element<X>;
+		template<typename... Xs>
+		concept expr_args = (expr_operand<Xs> && ...) && (is_vec_expr<Xs>::value || ...);
+
+		/* Element type used to evaluate a node. Scalar operands are broadcast to the vector operand type,
+		 * all vector operands must be of the same type. */
+		template<typename A, typename B>
+		struct expr_common2 { using type = std::common_type_t<A, B>; };
+		template<typename T, std::size_t N, typename A, typename B>
+		struct expr_common2<basic_vec<T, N, A>, B> { using type = basic_vec<T, N, A>; };
+		template<typename A, typename T, std::size_t N, typename B>
+		struct expr_common2<A, basic_vec<T, N, B>> { using type = basic_vec<T, N, B>; };
+		template<typename T, std::size_t N, typename A>
+		struct expr_common2<basic_vec<T, N, A>, basic_vec<T, N, A>> { using type = basic_vec<T, N, A>; };
+
+		template<typename... Vs>
+		struct expr_common;
+		template<typename V>
+		struct expr_common<V> { using type = V; };
+		template<typename V0, typename V1, typename... Vs>
+		struct expr_common<V0, V1, Vs...> : expr_common<typename expr_common2<V0, V1>::type, Vs...> {};
+
+		template<typename V, typename U>
+		[[nodiscard]] SEK_FORCEINLINE V expr_cast(const U &x) noexcept
+		{
+			if constexpr (std::same_as<U, V>)
+				return x;
+			else if constexpr (std::is_arithmetic_v<V>)
+				return static_cast<V>(x);
+			else
+				return V{static_cast<typename V::value_type>(x)};
+		}
+
+		/* Terminal referencing a span of vectors or scalars. */
+		template<typename V>
+		struct expr_span
+		{
+			using value_type = std::remove_const_t<V>;
+
+			[[nodiscard]] constexpr std::size_t size() const noexcept { return data.size(); }
+			[[nodiscard]] SEK_FORCEINLINE const value_type &operator[](std::size_t i) const noexcept { return data[i]; }
+
+			std::span<V> data;
+		};
+		/* Terminal broadcasting a single vector or scalar to every element. */
+		template<typename V>
+		struct expr_value
+		{
+			using value_type = V;
+
+			[[nodiscard]] constexpr std::size_t size() const noexcept { return std::dynamic_extent; }
+			[[nodiscard]] SEK_FORCEINLINE const value_type &operator[](std::size_t) const noexcept { return value; }
+
+			V value;
+		};
+		/* Node applying function `F` to elements of it's operands. */
+		template<typename F, typename... Es>
+		struct expr_node
+		{
+			using arg_type = typename expr_common<typename Es::value_type...>::type;
+			using value_type = std::remove_cvref_t<std::invoke_result_t<const F &, std::conditional_t<true, const arg_type &, Es>...>>;
+
+			constexpr expr_node(F f, Es... es) noexcept : func(f), args(es...)
+			{
+				SEK_ASSERT(size() == std::dynamic_extent || ((es.size() == std::dynamic_extent || es.size() == size()) && ...));
+			}
+
+			[[nodiscard]] constexpr std::size_t size() const noexcept
+			{
+				return std::apply([](const auto &...es)
+				{
+					std::size_t n = std::dynamic_extent;
+					((n = es.size() != std::dynamic_extent ? es.size() : n), ...);
+					return n;
+				}, args);
+			}
+			[[nodiscard]] SEK_FORCEINLINE value_type operator[](std::size_t i) const noexcept
+			{
+				return std::apply([&](const auto &...es) { return func(expr_cast<arg_type>(es[i])...); }, args);
+			}
+
+			F func;
+			std::tuple<Es...> args;
+		};
+
+		template<typename X>
+		[[nodiscard]] SEK_FORCEINLINE auto to_expr(const X &x) noexcept
+		{
+			if constexpr (is_vec_expr<X>::value)
+				return x.expr();
+			else
+				return expr_value<X>{x};
+		}
+		template<typename F, typename... Xs>
+		[[nodiscard]] SEK_FORCEINLINE auto make_expr(F f, const Xs &...xs) noexcept
+		{
+			using node_t = expr_node<F, decltype(to_expr(xs))...>;
+			return vec_expr<node_t>{node_t{f, to_expr(xs)...}};
+		}
+	}
+
+	/** @brief Lazy element-wise expression over spans of vectors or scalars.
+	 *
+	 * Expressions are created from contiguous ranges via `lazy`, and are combined using arithmetic operators and vector
+	 * math functions (`min`, `max`, `fmadd`, `lerp`, `sin`, etc.). Instead of producing a temporary array per operation, every
+	 * operation records a node of an expression tree, which is evaluated in a single pass when the expression is assigned
+	 * to a writable range expression. Every element of the result is computed using vector operations of `basic_vec`
+	 * and written once, without intermediate stores.
+	 *
+	 * Scalar operands (either constants or elements of scalar ranges) are broadcast to the vector type of the other operands.
+	 * Vector constants are broadcast to every element.
+	 *
+	 * @example
+	 * @code{cpp}
+	 * sek::lazy(out) = sek::fmadd(sek::lazy(a), s, sek::lazy(b)) - sek::lazy(c);
+	 * @endcode
+	 *
+	 * @note Expressions reference the underlying ranges, and must not outlive them.
+	 * @note Functions other than arithmetic operators require at least one vector operand.
+	 * @note Sizes of all range operands must be the same.
+	 *
+	 * @tparam E Type of the expression tree node. */
+	template<typename E>
+	class vec_expr
+	{
+		template<typename>
+		friend class vec_expr;
+
+		constexpr static bool is_writable = requires(const E &e) { { e.data[0] } -> std::same_as<typename E::value_type &>; };
+
+	public:
+		using expression_type = E;
+		/** Type of the elements of the expression. */
+		using value_type = typename E::value_type;
+
+	public:
+		constexpr vec_expr(const vec_expr &) noexcept = default;
+		constexpr explicit vec_expr(const E &expr) noexcept : m_expr(expr) {}
+
+		/** Evaluates expression \a other and writes the result to the elements of this expression.
+		 * @note This overload is defined only for expressions referencing a writable range.
+		 * @note Ranges of \a other may alias the range of this expression only if elements are at the same position. */
+		vec_expr &operator=(const vec_expr &other) noexcept requires is_writable { return assign(other.m_expr); }
+		/** @copydoc operator= */
+		template<typename E2>
+		vec_expr &operator=(const vec_expr<E2> &other) noexcept requires is_writable { return assign(other.m_expr); }
+		/** Sets every element of this expression to \a value.
+		 * @note This overload is defined only for expressions referencing a writable range. */
+		vec_expr &operator=(const value_type &value) noexcept requires is_writable { return assign(detail::expr_value<value_type>{value}); }
+
+		/** Equivalent to `*this = *this + other`. */
+		template<typename X>
+		vec_expr &operator+=(const X &other) noexcept requires is_writable { return *this = *this + other; }
+		/** Equivalent to `*this = *this - other`. */
+		template<typename X>
+		vec_expr &operator-=(const X &other) noexcept requires is_writable { return *this = *this - other; }
+		/** Equivalent to `*this = *this * other`. */
+		template<typename X>
+		vec_expr &operator*=(const X &other) noexcept requires is_writable { return *this = *this * other; }
+		/** Equivalent to `*this = *this / other`. */
+		template<typename X>
+		vec_expr &operator/=(const X &other) noexcept requires is_writable { return *this = *this / other; }
+
+		/** Returns the number of elements of the expression, or `std::dynamic_extent` if the expression does not reference any range. */
+		[[nodiscard]] constexpr std::size_t size() const noexcept { return m_expr.size(); }
+		/** Evaluates `i`th element of the expression. */
+		[[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept { return m_expr[i]; }
+
+		/** Returns the underlying expression tree node. */
+		[[nodiscard]] constexpr const E &expr() const noexcept { return m_expr; }
+
+	private:
+		template<typename E2>
+		vec_expr &assign(const E2 &other) noexcept
+		{
+			const auto n = size();
+			SEK_ASSERT(other.size() == std::dynamic_extent || other.size() == n);
+
+			const auto dst = m_expr.data.data();
+			for (std::size_t i = 0; i < n; ++i) dst[i] = detail::expr_cast<value_type>(other[i]);
+			return *this;
+		}
+
+		E m_expr;
+	};
+
+	/** Creates an expression referencing elements of contiguous range \a r of vectors or scalars.
+	 * If \a r is writable, the resulting expression can be assigned to. */
+	template<std::ranges::contiguous_range R>
+	[[nodiscard]] constexpr auto lazy(R &&r) noexcept requires std::ranges::sized_range<R> && std::ranges::borrowed_range<R> &&
+	                                                           detail::expr_element<std::ranges::range_value_t<R>>
+	{
+		using elem_t = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+		using node_t = detail::expr_span<elem_t>;
+		return vec_expr<node_t>{node_t{std::span<elem_t>{std::ranges::data(r), std::ranges::size(r)}}};
+	}
+
+#pragma region "vec_expr operators"
+	/** Creates an expression negating elements of expression \a x. */
+	template<typename E>
+	[[nodiscard]] inline auto operator-(const vec_expr<E> &x) noexcept { return detail::make_expr([](const auto &a) { return -a; }, x); }
+	/** Creates an expression adding elements of \a a and \a b. */
+	template<typename A, typename B>
+	[[nodiscard]] inline auto operator+(const A &a, const B &b) noexcept requires detail::expr_args<A, B>
+	{
+		return detail::make_expr([](const auto &x, const auto &y) { return x + y; }, a, b);
+	}
+	/** Creates an expression subtracting elements of \a b from elements of \a a. */
+	template<typename A, typename B>
+	[[nodiscard]] inline auto operator-(const A &a, const B &b) noexcept requires detail::expr_args<A, B>
+	{
+		return detail::make_expr([](const auto &x, const auto &y) { return x - y; }, a, b);
+	}
+	/** Creates an expression multiplying elements of \a a and \a b. */
+	template<typename A, typename B>
+	[[nodiscard]] inline auto operator*(const A &a, const B &b) noexcept requires detail::expr_args<A, B>
+	{
+		return detail::make_expr([](const auto &x, const auto &y) { return x * y; }, a, b);
+	}
+	/** Creates an expression dividing elements of \a a by elements of \a b. */
+	template<typename A, typename B>
+	[[nodiscard]] inline auto operator/(const A &a, const B &b) noexcept requires detail::expr_args<A, B>
+	{
+		return detail::make_expr([](const auto &x, const auto &y) { return x / y; }, a, b);
+	}
+#pragma endregion
+
+#pragma region "vec_expr functions"
+/* Every function creates an expression node invoking the vector overload of the same function. */
+#define SEK_MAKE_EXPR_FUNC1(func)                                                                       \
+    template<typename X>                                                                                \
+    [[nodiscard]] inline auto func(const X &x) noexcept requires detail::expr_args<X>                   \
+    {                                                                                                   \
+        return detail::make_expr([](const auto &a) { return sek::func(a); }, x);                        \
+    }
+#define SEK_MAKE_EXPR_FUNC2(func)                                                                       \
+    template<typename X, typename Y>                                                                    \
+    [[nodiscard]] inline auto func(const X &x, const Y &y) noexcept requires detail::expr_args<X, Y>    \
+    {                                                                                                   \
+        return detail::make_expr([](const auto &a, const auto &b) { return sek::func(a, b); }, x, y);   \
+    }
+#define SEK_MAKE_EXPR_FUNC3(func)                                                                                   \
+    template<typename X, typename Y, typename Z>                                                                    \
+    [[nodiscard]] inline auto func(const X &x, const Y &y, const Z &z) noexcept requires detail::expr_args<X, Y, Z> \
+    {                                                                                                               \
+        return detail::make_expr([](const auto &a, const auto &b, const auto &c) { return sek::func(a, b, c); }, x, y, z); \
+    }
+
+	SEK_MAKE_EXPR_FUNC2(min)
+	SEK_MAKE_EXPR_FUNC2(max)
+
+	SEK_MAKE_EXPR_FUNC1(abs)
+	SEK_MAKE_EXPR_FUNC1(fabs)
+	SEK_MAKE_EXPR_FUNC2(fmod)
+	SEK_MAKE_EXPR_FUNC2(remainder)
+	SEK_MAKE_EXPR_FUNC2(fmax)
+	SEK_MAKE_EXPR_FUNC2(fmin)
+	SEK_MAKE_EXPR_FUNC2(fdim)
+	SEK_MAKE_EXPR_FUNC3(lerp)
+	SEK_MAKE_EXPR_FUNC3(fmadd)
+	SEK_MAKE_EXPR_FUNC3(fmsub)
+	SEK_MAKE_EXPR_FUNC3(fnmadd)
+	SEK_MAKE_EXPR_FUNC3(fnmsub)
+	SEK_MAKE_EXPR_FUNC3(fma)
+
+	SEK_MAKE_EXPR_FUNC1(sin)
+	SEK_MAKE_EXPR_FUNC1(cos)
+	SEK_MAKE_EXPR_FUNC1(tan)
+	SEK_MAKE_EXPR_FUNC1(asin)
+	SEK_MAKE_EXPR_FUNC1(acos)
+	SEK_MAKE_EXPR_FUNC1(atan)
+	SEK_MAKE_EXPR_FUNC2(atan2)
+
+#undef SEK_MAKE_EXPR_FUNC1
+#undef SEK_MAKE_EXPR_FUNC2
+#undef SEK_MAKE_EXPR_FUNC3
+#pragma endregion
+}
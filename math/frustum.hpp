@@ -0,0 +1,240 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "bounds.hpp"
+
+namespace sek
+{
+	/** Depth range of the clip space produced by a projection matrix. */
+	enum clip_range
+	{
+		/** Clip-space depth is within [-w, w] (OpenGL convention, used by `project` & `unproject`). */
+		clip_neg_one_to_one,
+		/** Clip-space depth is within [0, w] (Direct3D & Vulkan convention). */
+		clip_zero_to_one,
+	};
+
+	/** @brief Structure used to define a view frustum via 6 inward-facing planes.
+	 *
+	 * Planes are extracted from the rows of a (projection * view) matrix using the clip-space inequalities (Gribb & Hartmann).
+	 * Extraction does not depend on handedness of the matrix, so frusta of both right-handed and left-handed
+	 * (`SEK_FORCE_LEFT_HANDED`) projections are supported.
+	 *
+	 * Batch culling functions test `native_vec<T>::size()` volumes per iteration, where every volume is a lane of the
+	 * vector and every plane is broadcast to all lanes.
+	 *
+	 * @tparam T Value type of the frustum planes.
+	 * @tparam Abi ABI tag used by the plane vectors. */
+	template<std::floating_point T, typename Abi = math_abi::deduce_t<T, 4, math_abi::fixed_size<4>>>
+	class basic_frustum
+	{
+	public:
+		/** Plane vector type. Plane `(a, b, c, d)` contains points `p` where `a * p.x + b * p.y + c * p.z + d == 0`. */
+		using plane_type = basic_vec<T, 4, Abi>;
+		using value_type = T;
+
+		/** Indices of the frustum planes. */
+		enum plane_index
+		{
+			plane_left,
+			plane_right,
+			plane_bottom,
+			plane_top,
+			plane_near,
+			plane_far,
+		};
+
+	private:
+		template<typename A>
+		[[nodiscard]] static plane_type row(const basic_mat<T, 4, 4, A> &m, std::size_t i) noexcept { return {m[0][i], m[1][i], m[2][i], m[3][i]}; }
+		[[nodiscard]] static plane_type normalize_plane(const plane_type &p) noexcept { return p / std::sqrt(dot(p.xyz(), p.xyz())); }
+
+	public:
+		constexpr basic_frustum() noexcept = default;
+
+		/** Extracts frustum planes from matrix \a m.
+		 * @param m Projection matrix, or a combined (projection * view) or (projection * view * model) matrix.
+		 * In the latter cases, planes are expressed in the world or model space respectively.
+		 * @param range Clip-space depth range of \a m. */
+		template<typename A>
+		explicit basic_frustum(const basic_mat<T, 4, 4, A> &m, clip_range range = clip_neg_one_to_one) noexcept
+		{
+			const auto r0 = row(m, 0), r1 = row(m, 1), r2 = row(m, 2), r3 = row(m, 3);
+			m_planes[plane_left] = normalize_plane(r3 + r0);
+			m_planes[plane_right] = normalize_plane(r3 - r0);
+			m_planes[plane_bottom] = normalize_plane(r3 + r1);
+			m_planes[plane_top] = normalize_plane(r3 - r1);
+			m_planes[plane_near] = normalize_plane(range == clip_zero_to_one ? r2 : r3 + r2);
+			m_planes[plane_far] = normalize_plane(r3 - r2);
+		}
+
+		/** Returns the `i`th plane of the frustum.
+		 * @throw std::range_error In case \a i exceeds `6`. */
+		[[nodiscard]] const plane_type &plane(std::size_t i) const
+		{
+			if (i >= 6) [[unlikely]] throw std::range_error("Plane index out of range");
+			return m_planes[i];
+		}
+
+		/** Checks if point \a p is inside the frustum. */
+		template<typename A>
+		[[nodiscard]] bool contains(const basic_vec<T, 3, A> &p) const noexcept { return intersects(p, T{0}); }
+		/** Checks if sphere of center \a c and radius \a r intersects or is inside the frustum. */
+		template<typename A>
+		[[nodiscard]] bool intersects(const basic_vec<T, 3, A> &c, T r) const noexcept
+		{
+			for (auto &p: m_planes)
+				if (p[0] * c[0] + p[1] * c[1] + p[2] * c[2] + p[3] < -r) return false;
+			return true;
+		}
+		/** Checks if bounding box \a b intersects or is inside the frustum.
+		 * @note The test is conservative, boxes outside of the frustum near it's corners may be reported as intersecting. */
+		template<typename A>
+		[[nodiscard]] bool intersects(const basic_bounds<T, 3, A> &b) const noexcept
+		{
+			const auto c = b.center(), e = b.size() / T{2};
+			for (auto &p: m_planes)
+			{
+				const auto d = p[0] * c[0] + p[1] * c[1] + p[2] * c[2] + p[3];
+				const auto r = std::abs(p[0]) * e[0] + std::abs(p[1]) * e[1] + std::abs(p[2]) * e[2];
+				if (d < -r) return false;
+			}
+			return true;
+		}
+
+		/** Tests bounding boxes \a boxes against the frustum. Element `i` of \a out is set to `1` if `intersects(boxes[i])`, `0` otherwise.
+		 * @note Size of \a out must be at least the size of \a boxes. */
+		template<typename A>
+		void cull(std::span<const basic_bounds<T, 3, A>> boxes, std::span<std::uint8_t> out) const noexcept
+		{
+			SEK_ASSERT(out.size() >= boxes.size());
+			cull_boxes(boxes, [&](std::size_t i, bool v) { out[i] = v; });
+		}
+		/** Tests bounding boxes \a boxes against the frustum. Bit `i % 64` of element `i / 64` of \a out is set if `intersects(boxes[i])`, and cleared otherwise.
+		 * @note Size of \a out must be at least `(boxes.size() + 63) / 64`. */
+		template<typename A>
+		void cull(std::span<const basic_bounds<T, 3, A>> boxes, std::span<std::uint64_t> out) const noexcept
+		{
+			SEK_ASSERT(out.size() * 64 >= boxes.size());
+			std::fill_n(out.data(), (boxes.size() + 63) / 64, std::uint64_t{0});
+			cull_boxes(boxes, [&](std::size_t i, bool v) { out[i / 64] |= static_cast<std::uint64_t>(v) << (i % 64); });
+		}
+
+		/** Tests spheres of centers \a centers and radii \a radii against the frustum. Element `i` of \a out is set to `1`
+		 * if `intersects(centers[i], radii[i])`, `0` otherwise.
+		 * @note Sizes of \a radii & \a out must be at least the size of \a centers. */
+		template<typename A>
+		void cull(std::span<const basic_vec<T, 3, A>> centers, std::span<const T> radii, std::span<std::uint8_t> out) const noexcept
+		{
+			SEK_ASSERT(radii.size() >= centers.size() && out.size() >= centers.size());
+			cull_spheres(centers, radii, [&](std::size_t i, bool v) { out[i] = v; });
+		}
+		/** Tests spheres of centers \a centers and radii \a radii against the frustum. Bit `i % 64` of element `i / 64`
+		 * of \a out is set if `intersects(centers[i], radii[i])`, and cleared otherwise.
+		 * @note Size of \a radii must be at least the size of \a centers, size of \a out must be at least `(centers.size() + 63) / 64`. */
+		template<typename A>
+		void cull(std::span<const basic_vec<T, 3, A>> centers, std::span<const T> radii, std::span<std::uint64_t> out) const noexcept
+		{
+			SEK_ASSERT(radii.size() >= centers.size() && out.size() * 64 >= centers.size());
+			std::fill_n(out.data(), (centers.size() + 63) / 64, std::uint64_t{0});
+			cull_spheres(centers, radii, [&](std::size_t i, bool v) { out[i / 64] |= static_cast<std::uint64_t>(v) << (i % 64); });
+		}
+
+	private:
+		/* Every box is converted to center-extent form, and is outside if it's center is further behind any plane than
+		 * the projection of it's extent onto the plane normal. Planes are broadcast once per call. */
+		template<typename A, typename F>
+		void cull_boxes(std::span<const basic_bounds<T, 3, A>> boxes, F &&store) const noexcept
+		{
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+
+			lane_t pl[6][4], pa[6][3];
+			for (std::size_t j = 0; j < 6; ++j)
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					pl[j][k] = lane_t{m_planes[j][k]};
+					if (k < 3) pa[j][k] = lane_t{std::abs(m_planes[j][k])};
+				}
+
+			alignas(align) T buff[6][w];
+			for (std::size_t i = 0; i < boxes.size(); i += w)
+			{
+				const auto n = std::min(w, boxes.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(buff[0], 6 * w, T{0});
+				for (std::size_t j = 0; j < n; ++j)
+				{
+					const auto c = boxes[i + j].center(), e = boxes[i + j].size() / T{2};
+					for (std::size_t k = 0; k < 3; ++k)
+					{
+						buff[k][j] = c[k];
+						buff[k + 3][j] = e[k];
+					}
+				}
+
+				lane_t c[3], e[3];
+				for (std::size_t k = 0; k < 3; ++k)
+				{
+					to_simd(c[k]).copy_from(buff[k], dpm::vector_aligned);
+					to_simd(e[k]).copy_from(buff[k + 3], dpm::vector_aligned);
+				}
+
+				auto visible = lane_t{T{0}} == lane_t{T{0}};
+				for (std::size_t j = 0; j < 6; ++j)
+				{
+					const auto d = fmadd(pl[j][0], c[0], fmadd(pl[j][1], c[1], fmadd(pl[j][2], c[2], pl[j][3])));
+					const auto r = fmadd(pa[j][0], e[0], fmadd(pa[j][1], e[1], pa[j][2] * e[2]));
+					visible = visible && (d >= -r);
+				}
+				for (std::size_t j = 0; j < n; ++j) store(i + j, static_cast<bool>(visible[j]));
+			}
+		}
+		template<typename A, typename F>
+		void cull_spheres(std::span<const basic_vec<T, 3, A>> centers, std::span<const T> radii, F &&store) const noexcept
+		{
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+
+			lane_t pl[6][4];
+			for (std::size_t j = 0; j < 6; ++j)
+				for (std::size_t k = 0; k < 4; ++k) pl[j][k] = lane_t{m_planes[j][k]};
+
+			alignas(align) T buff[4][w];
+			for (std::size_t i = 0; i < centers.size(); i += w)
+			{
+				const auto n = std::min(w, centers.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(buff[0], 4 * w, T{0});
+				for (std::size_t j = 0; j < n; ++j)
+				{
+					for (std::size_t k = 0; k < 3; ++k) buff[k][j] = centers[i + j][k];
+					buff[3][j] = radii[i + j];
+				}
+
+				lane_t c[3], r;
+				for (std::size_t k = 0; k < 3; ++k) to_simd(c[k]).copy_from(buff[k], dpm::vector_aligned);
+				to_simd(r).copy_from(buff[3], dpm::vector_aligned);
+
+				auto visible = lane_t{T{0}} == lane_t{T{0}};
+				for (std::size_t j = 0; j < 6; ++j)
+				{
+					const auto d = fmadd(pl[j][0], c[0], fmadd(pl[j][1], c[1], fmadd(pl[j][2], c[2], pl[j][3])));
+					visible = visible && (d >= -r);
+				}
+				for (std::size_t j = 0; j < n; ++j) store(i + j, static_cast<bool>(visible[j]));
+			}
+		}
+
+		plane_type m_planes[6] = {};
+	};
+
+	/** Alias for view frustum that uses implementation-defined ABI deduced from it's type. */
+	template<typename T>
+	using frustum = basic_frustum<T>;
+}
@@ -0,0 +1,379 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <optional>
+#include <numeric>
+#include <atomic>
+#include <bit>
+
+#include "detail/parallel.hpp"
+#include "morton.hpp"
+#include "bvh.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Parallel LSD radix sort of `keys` & `values` by 8-bit digits. `tmp_keys` & `tmp_values` are used as scratch space.
+		 * Digits where all keys fall into the same bucket are skipped. */
+		template<typename K, typename V>
+		inline void radix_sort(std::vector<K> &keys, std::vector<V> &values, std::vector<K> &tmp_keys, std::vector<V> &tmp_values, std::size_t n_chunks)
+		{
+			constexpr std::size_t radix = 256;
+			const auto n = keys.size();
+			tmp_keys.resize(n);
+			tmp_values.resize(n);
+
+			std::vector<std::size_t> counts(n_chunks * radix);
+			for (std::size_t shift = 0; shift < std::numeric_limits<K>::digits; shift += 8)
+			{
+				std::fill(counts.begin(), counts.end(), std::size_t{0});
+				parallel_chunks(n, n_chunks, [&](std::size_t c, std::size_t first, std::size_t last)
+				{
+					const auto chunk_counts = counts.data() + c * radix;
+					for (auto i = first; i < last; ++i) ++chunk_counts[(keys[i] >> shift) & (radix - 1)];
+				});
+
+				/* Exclusive prefix sum over digits, where elements of a digit are ordered by chunk to keep the sort stable. */
+				std::size_t total = 0;
+				bool skip = false;
+				for (std::size_t d = 0; d < radix; ++d)
+				{
+					std::size_t digit_total = 0;
+					for (std::size_t c = 0; c < n_chunks; ++c)
+					{
+						const auto count = counts[c * radix + d];
+						counts[c * radix + d] = total;
+						total += count;
+						digit_total += count;
+					}
+					if (digit_total == n) skip = true;
+				}
+				if (skip) continue;
+
+				parallel_chunks(n, n_chunks, [&](std::size_t c, std::size_t first, std::size_t last)
+				{
+					const auto cursors = counts.data() + c * radix;
+					for (auto i = first; i < last; ++i)
+					{
+						const auto dst = cursors[(keys[i] >> shift) & (radix - 1)]++;
+						tmp_keys[dst] = keys[i];
+						tmp_values[dst] = values[i];
+					}
+				});
+				keys.swap(tmp_keys);
+				values.swap(tmp_values);
+			}
+		}
+	}
+
+	/** @brief Linear bounding volume hierarchy over a set of 3D axis-aligned bounding boxes.
+	 *
+	 * The hierarchy is built from Morton keys of the box centers, which are radix-sorted in parallel. Internal nodes
+	 * are then emitted independently of each other in O(n) (T. Karras, "Maximizing Parallelism in the Construction of BVHs,
+	 * Octrees, and k-d Trees", 2012), and bounds are refitted bottom-up in parallel, where the last thread to reach a node
+	 * (determined via an atomic counter) computes it's bounds.
+	 *
+	 * Build quality is lower than that of the SAH `basic_bvh`, but builds are fast enough to rebuild fully dynamic scenes every frame.
+	 *
+	 * @tparam T Value type of the bounding boxes.
+	 * @tparam Abi ABI tag of the bounding boxes. */
+	template<std::floating_point T, typename Abi = math_abi::deduce_t<T, 3, math_abi::fixed_size<3>>>
+	class basic_lbvh
+	{
+	public:
+		using value_type = T;
+		using bounds_type = basic_bounds<T, 3, Abi>;
+		using vector_type = basic_vec<T, 3, Abi>;
+		using hit_result = typename basic_bvh<T, Abi>::hit_result;
+
+		/** Minimum number of boxes processed by a single thread during a build. */
+		constexpr static std::size_t parallel_grain = 16384;
+
+	private:
+		/* Children with `leaf_bit` set reference leaves, otherwise internal nodes. */
+		constexpr static std::uint32_t leaf_bit = std::uint32_t{1} << 31;
+		constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+		struct node_type
+		{
+			bounds_type bounds;
+			std::uint32_t child[2];
+		};
+
+		[[nodiscard]] static bool overlaps(const bounds_type &a, const bounds_type &b) noexcept
+		{
+			return all_of(a.min() <= b.max()) && all_of(a.max() >= b.min());
+		}
+
+	public:
+		/** Initializes an empty hierarchy. */
+		basic_lbvh() noexcept = default;
+
+		/** Builds the hierarchy over bounding boxes \a bounds. User index of every primitive is it's position within \a bounds. */
+		explicit basic_lbvh(std::span<const bounds_type> bounds) { build(bounds); }
+		/** Builds the hierarchy over bounding boxes \a bounds with user indices \a indices.
+		 * @note Size of \a indices must match the size of \a bounds. */
+		basic_lbvh(std::span<const bounds_type> bounds, std::span<const std::uint32_t> indices) { build(bounds, indices); }
+
+		/** Returns the number of primitives in the hierarchy. */
+		[[nodiscard]] std::size_t size() const noexcept { return m_index.size(); }
+		/** Checks if the hierarchy is empty. */
+		[[nodiscard]] bool empty() const noexcept { return m_index.empty(); }
+		/** Returns the bounding box of all primitives of the hierarchy. */
+		[[nodiscard]] bounds_type bounds() const noexcept
+		{
+			if (m_index.empty()) [[unlikely]] return detail::bounds_empty<T, 3, Abi>();
+			return m_nodes.empty() ? m_bounds[0] : m_nodes[0].bounds;
+		}
+
+		/** Rebuilds the hierarchy over bounding boxes \a bounds. User index of every primitive is it's position within \a bounds. */
+		void build(std::span<const bounds_type> bounds)
+		{
+			std::vector<std::uint32_t> indices(bounds.size());
+			std::iota(indices.begin(), indices.end(), std::uint32_t{0});
+			build(bounds, indices);
+		}
+		/** Rebuilds the hierarchy over bounding boxes \a bounds with user indices \a indices.
+		 * @note Size of \a indices must match the size of \a bounds. */
+		void build(std::span<const bounds_type> bounds, std::span<const std::uint32_t> indices)
+		{
+			SEK_ASSERT(bounds.size() == indices.size());
+			SEK_ASSERT(bounds.size() < leaf_bit);
+
+			const auto n = bounds.size();
+			const auto n_chunks = detail::parallel_chunk_count(n, parallel_grain);
+			m_nodes.clear();
+			m_bounds.resize(n);
+			m_index.resize(n);
+			m_refs.resize(n);
+			if (n == 0) return;
+
+			/* Morton keys of the box centers, quantized within the bounds of all centers. */
+			std::vector<vector_type> centers(n);
+			std::vector<std::uint64_t> keys(n);
+			detail::parallel_chunks(n, n_chunks, [&](std::size_t, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i) centers[i] = bounds[i].center();
+			});
+			auto cmin = centers[0], cmax = centers[0];
+			for (auto &c: centers)
+			{
+				cmin = sek::min(cmin, c);
+				cmax = sek::max(cmax, c);
+			}
+			detail::parallel_chunks(n, n_chunks, [&](std::size_t, std::size_t first, std::size_t last)
+			{
+				morton_keys(std::span<const vector_type>{centers}.subspan(first, last - first), bounds_type{cmin, cmax}, std::span{keys}.subspan(first, last - first));
+			});
+
+			std::iota(m_refs.begin(), m_refs.end(), std::uint32_t{0});
+			{
+				std::vector<std::uint64_t> tmp_keys;
+				std::vector<std::uint32_t> tmp_refs;
+				detail::radix_sort(keys, m_refs, tmp_keys, tmp_refs, n_chunks);
+			}
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				m_bounds[i] = bounds[m_refs[i]];
+				m_index[i] = indices[m_refs[i]];
+			}
+			if (n == 1) return;
+
+			/* Every internal node is emitted independently from the sorted keys. */
+			m_nodes.resize(n - 1);
+			m_parents.assign(n * 2 - 1, npos);
+			detail::parallel_chunks(n - 1, n_chunks, [&](std::size_t, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i) emit_node(keys, static_cast<std::int64_t>(i));
+			});
+			refit_nodes(n_chunks);
+		}
+
+		/** Updates bounding boxes of the hierarchy without changing it's topology.
+		 * @param bounds New bounding boxes of the primitives, in the same order as passed to `build`. */
+		void refit(std::span<const bounds_type> bounds)
+		{
+			SEK_ASSERT(bounds.size() == m_refs.size());
+			for (std::size_t i = 0; i < m_refs.size(); ++i) m_bounds[i] = bounds[m_refs[i]];
+			if (!m_nodes.empty()) refit_nodes(detail::parallel_chunk_count(m_refs.size(), parallel_grain));
+		}
+
+		/** Invokes \a f with the user index of every primitive whose bounding box overlaps bounding box \a b. */
+		template<typename F>
+		void query_overlap(const bounds_type &b, F &&f) const
+		{
+			traverse([&](const bounds_type &nb) { return overlaps(nb, b); }, [&](std::uint32_t i) { f(m_index[i]); });
+		}
+		/** Invokes \a f with the user index of every primitive whose bounding box contains point \a p. */
+		template<typename F>
+		void query_point(const vector_type &p, F &&f) const
+		{
+			traverse([&](const bounds_type &nb) { return all_of(nb.min() <= p) && all_of(nb.max() >= p); }, [&](std::uint32_t i) { f(m_index[i]); });
+		}
+		/** Finds the closest primitive intersected by ray \a r, using bounding boxes of the primitives as their geometry.
+		 * @param r Ray to intersect.
+		 * @param tmax Maximum distance along the ray.
+		 * @return Closest hit, or an empty optional if the ray does not hit any primitive within \a tmax. */
+		[[nodiscard]] std::optional<hit_result> nearest_hit(const basic_ray<T, 3, Abi> &r, T tmax = std::numeric_limits<T>::infinity()) const
+		{
+			struct entry
+			{
+				std::uint32_t node;
+				T tnear;
+			};
+
+			if (m_index.empty()) [[unlikely]] return std::nullopt;
+
+			std::optional<hit_result> result;
+			const auto visit_leaf = [&](std::uint32_t i)
+			{
+				if (const auto hit = intersect(r, m_bounds[i], T{0}, tmax); hit.hit())
+				{
+					tmax = hit.tnear;
+					result = hit_result{m_index[i], hit.tnear};
+				}
+			};
+			if (m_nodes.empty())
+			{
+				visit_leaf(0);
+				return result;
+			}
+
+			detail::bvh_stack<entry> stack;
+			stack.push({0, T{0}});
+			while (!stack.empty())
+			{
+				const auto [idx, tnear] = stack.pop();
+				if (tnear > tmax) continue;
+
+				/* Children are pushed far-to-near, so that the nearer child is visited first. */
+				entry children[2];
+				std::size_t n_children = 0;
+				for (auto c: m_nodes[idx].child)
+				{
+					if (c & leaf_bit)
+						visit_leaf(c & ~leaf_bit);
+					else if (const auto hit = intersect(r, m_nodes[c].bounds, T{0}, tmax); hit.hit())
+						children[n_children++] = {c, hit.tnear};
+				}
+				if (n_children == 2 && children[0].tnear < children[1].tnear) std::swap(children[0], children[1]);
+				for (std::size_t i = 0; i < n_children; ++i) stack.push(children[i]);
+			}
+			return result;
+		}
+
+	private:
+		/* Returns length of the common prefix of keys `i` & `j`, or `-1` if `j` is out of range. Equal keys are
+		 * disambiguated by their indices, which makes all keys unique. */
+		[[nodiscard]] static int common_prefix(const std::vector<std::uint64_t> &keys, std::int64_t i, std::int64_t j) noexcept
+		{
+			if (j < 0 || j >= static_cast<std::int64_t>(keys.size())) return -1;
+
+			const auto ki = keys[static_cast<std::size_t>(i)], kj = keys[static_cast<std::size_t>(j)];
+			if (ki == kj) return 64 + std::countl_zero(static_cast<std::uint64_t>(i ^ j));
+			return std::countl_zero(ki ^ kj);
+		}
+		void emit_node(const std::vector<std::uint64_t> &keys, std::int64_t i) noexcept
+		{
+			/* Direction of the node range is towards the neighbor with the longer common prefix. */
+			const auto d = common_prefix(keys, i, i + 1) - common_prefix(keys, i, i - 1) > 0 ? 1 : -1;
+			const auto min_prefix = common_prefix(keys, i, i - d);
+
+			/* Exponential, then binary search for the other end of the range. */
+			std::int64_t l_max = 2;
+			while (common_prefix(keys, i, i + l_max * d) > min_prefix) l_max *= 2;
+			std::int64_t l = 0;
+			for (auto t = l_max / 2; t >= 1; t /= 2)
+				if (common_prefix(keys, i, i + (l + t) * d) > min_prefix) l += t;
+			const auto j = i + l * d;
+
+			/* Binary search for the split position, I.e. the highest differing bit within the range. */
+			const auto node_prefix = common_prefix(keys, i, j);
+			std::int64_t s = 0;
+			for (auto t = l;;)
+			{
+				t = (t + 1) / 2;
+				if (common_prefix(keys, i, i + (s + t) * d) > node_prefix) s += t;
+				if (t <= 1) break;
+			}
+			const auto split = i + s * d + std::min(d, 0);
+
+			const auto n = static_cast<std::int64_t>(keys.size());
+			const auto left = static_cast<std::uint32_t>(split), right = static_cast<std::uint32_t>(split + 1);
+			auto &node = m_nodes[static_cast<std::size_t>(i)];
+			node.child[0] = std::min(i, j) == split ? left | leaf_bit : left;
+			node.child[1] = std::max(i, j) == split + 1 ? right | leaf_bit : right;
+
+			/* Parents of internal nodes are stored first, followed by parents of leaves. */
+			for (auto c: node.child)
+			{
+				const auto slot = c & leaf_bit ? static_cast<std::size_t>(n - 1) + (c & ~leaf_bit) : c;
+				m_parents[slot] = static_cast<std::uint32_t>(i);
+			}
+		}
+		void refit_nodes(std::size_t n_chunks)
+		{
+			const auto n = m_bounds.size();
+			auto visits = std::vector<std::uint32_t>(n - 1, 0);
+
+			/* Every leaf walks up the hierarchy. The first thread to reach a node stops, the second one computes it's bounds,
+			 * at which point bounds of both children are complete. */
+			detail::parallel_chunks(n, n_chunks, [&](std::size_t, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i)
+				{
+					auto node = m_parents[n - 1 + i];
+					while (node != npos)
+					{
+						if (std::atomic_ref{visits[node]}.fetch_add(1, std::memory_order_acq_rel) == 0) break;
+
+						auto &nb = m_nodes[node];
+						const auto child_bounds = [&](std::uint32_t c) { return c & leaf_bit ? m_bounds[c & ~leaf_bit] : m_nodes[c].bounds; };
+						nb.bounds = detail::bounds_union(child_bounds(nb.child[0]), child_bounds(nb.child[1]));
+						node = m_parents[node];
+					}
+				}
+			});
+		}
+
+		template<typename NF, typename LF>
+		void traverse(NF &&test_node, LF &&visit_leaf) const
+		{
+			if (m_index.empty()) [[unlikely]] return;
+			if (m_nodes.empty())
+			{
+				if (test_node(m_bounds[0])) visit_leaf(0);
+				return;
+			}
+
+			detail::bvh_stack<std::uint32_t> stack;
+			stack.push(0);
+			while (!stack.empty())
+			{
+				for (auto c: m_nodes[stack.pop()].child)
+				{
+					if (c & leaf_bit)
+					{
+						if (test_node(m_bounds[c & ~leaf_bit])) visit_leaf(c & ~leaf_bit);
+					}
+					else if (test_node(m_nodes[c].bounds))
+						stack.push(c);
+				}
+			}
+		}
+
+		std::vector<node_type> m_nodes;
+		std::vector<std::uint32_t> m_parents;
+		std::vector<bounds_type> m_bounds;
+		std::vector<std::uint32_t> m_index;
+		std::vector<std::uint32_t> m_refs;
+	};
+
+	/** Alias for linear bounding volume hierarchy over `bbox<T>`. */
+	template<typename T>
+	using lbvh = basic_lbvh<T, math_abi::deduce_t<T, 3, math_abi::fixed_size<3>>>;
+}
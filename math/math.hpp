@@ -8,5 +8,16 @@
 #include "math/vector.hpp"
 #include "math/matrix.hpp"
 #include "math/quaternion.hpp"
+#include "math/affine.hpp"
+#include "math/dual_quat.hpp"
 #include "math/bounds.hpp"
-#include "math/random.hpp"
\ No newline at end of file
+#include "math/random.hpp"
+#include "math/sampling.hpp"
+#include "math/serialize.hpp"
+#include "math/morton.hpp"
+#include "math/ray.hpp"
+#include "math/bvh.hpp"
+#include "math/lbvh.hpp"
+#include "math/spatial_grid.hpp"
+#include "math/frustum.hpp"
+#include "math/expr.hpp"
\ No newline at end of file
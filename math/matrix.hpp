@@ -8,3 +8,5 @@
 #include "detail/fcmp_mat.hpp"
 #include "detail/inverse.hpp"
 #include "detail/trans.hpp"
+#include "detail/batch_mat.hpp"
+#include "detail/batch_inverse.hpp"
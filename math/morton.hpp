@@ -0,0 +1,217 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "bounds.hpp"
+
+namespace sek
+{
+	/** Number of bits per axis of an N-dimensional Morton or Hilbert key of type `K`. */
+	template<std::unsigned_integral K, std::size_t N>
+	inline constexpr std::size_t spatial_key_bits = std::numeric_limits<K>::digits / N;
+
+	namespace detail
+	{
+		/* Bit-interleave ("spread") masks, where step `i` shifts by `shifts[i]` and masks with `masks[i]`. */
+		template<typename K, std::size_t N>
+		struct morton_masks;
+		template<>
+		struct morton_masks<std::uint32_t, 2>
+		{
+			constexpr static std::uint32_t shifts[] = {8, 4, 2, 1};
+			constexpr static std::uint32_t masks[] = {0x00ff'00ff, 0x0f0f'0f0f, 0x3333'3333, 0x5555'5555};
+		};
+		template<>
+		struct morton_masks<std::uint64_t, 2>
+		{
+			constexpr static std::uint64_t shifts[] = {16, 8, 4, 2, 1};
+			constexpr static std::uint64_t masks[] = {0x0000'ffff'0000'ffff, 0x00ff'00ff'00ff'00ff, 0x0f0f'0f0f'0f0f'0f0f, 0x3333'3333'3333'3333, 0x5555'5555'5555'5555};
+		};
+		template<>
+		struct morton_masks<std::uint32_t, 3>
+		{
+			constexpr static std::uint32_t shifts[] = {16, 8, 4, 2};
+			constexpr static std::uint32_t masks[] = {0x0300'00ff, 0x0300'f00f, 0x030c'30c3, 0x0924'9249};
+		};
+		template<>
+		struct morton_masks<std::uint64_t, 3>
+		{
+			constexpr static std::uint64_t shifts[] = {32, 16, 8, 4, 2};
+			constexpr static std::uint64_t masks[] = {0x001f'0000'0000'ffff, 0x001f'0000'ff00'00ff, 0x100f'00f0'0f00'f00f, 0x10c3'0c30'c30c'30c3, 0x1249'2492'4924'9249};
+		};
+
+		/* Spreads the low `spatial_key_bits<K, N>` bits of `x` so that there are `N - 1` zero bits between every bit.
+		 * `L` is either `K` or a vector of `K`, so the same code is used for scalar and lane-parallel keys. */
+		template<typename K, std::size_t N, typename L>
+		[[nodiscard]] constexpr SEK_FORCEINLINE L morton_spread(L x) noexcept
+		{
+			using masks_t = morton_masks<K, N>;
+			x = x & L{static_cast<K>((K{1} << spatial_key_bits<K, N>) - 1)};
+			for (std::size_t i = 0; i < std::size(masks_t::shifts); ++i)
+				x = (x | (x << masks_t::shifts[i])) & L{masks_t::masks[i]};
+			return x;
+		}
+		/* Interleaves coordinates `x`, where bit `b` of `x[i]` becomes bit `b * N + N - 1 - i` of the key. */
+		template<typename K, std::size_t N, typename L>
+		[[nodiscard]] constexpr SEK_FORCEINLINE L morton_interleave(const L (&x)[N]) noexcept
+		{
+			auto result = morton_spread<K, N>(x[N - 1]);
+			for (std::size_t i = 1; i < N; ++i) result = result | (morton_spread<K, N>(x[N - 1 - i]) << static_cast<K>(i));
+			return result;
+		}
+
+		/* Converts coordinates `x` in-place into the transposed Hilbert index (J. Skilling, "Programming the Hilbert curve", 2004).
+		 * Conditionals of the original algorithm are replaced with all-ones or all-zeros bit masks, so that it is branch-free. */
+		template<typename K, std::size_t N, typename L>
+		constexpr SEK_FORCEINLINE void hilbert_transpose(L (&x)[N], std::size_t bits) noexcept
+		{
+			const auto bit_mask = [](const L &v, std::size_t b) { return L{K{0}} - ((v >> static_cast<K>(b)) & L{K{1}}); };
+
+			/* Inverse undo excess work. */
+			for (auto b = bits; b-- > 1;)
+			{
+				const auto p = L{static_cast<K>((K{1} << b) - 1)};
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					const auto m = bit_mask(x[i], b);
+					const auto t = (x[0] ^ x[i]) & p & ~m;
+					x[0] = x[0] ^ (p & m) ^ t;
+					x[i] = x[i] ^ t;
+				}
+			}
+
+			/* Gray encode. */
+			for (std::size_t i = 1; i < N; ++i) x[i] = x[i] ^ x[i - 1];
+			auto t = L{K{0}};
+			for (auto b = bits; b-- > 1;)
+				t = t ^ (L{static_cast<K>((K{1} << b) - 1)} & bit_mask(x[N - 1], b));
+			for (std::size_t i = 0; i < N; ++i) x[i] = x[i] ^ t;
+		}
+		template<typename K, std::size_t N, typename L>
+		[[nodiscard]] constexpr SEK_FORCEINLINE L hilbert_interleave(L (&x)[N], std::size_t bits) noexcept
+		{
+			/* Transposed index is interleaved with the first coordinate in the most significant position. */
+			hilbert_transpose<K, N>(x, bits);
+			return morton_interleave<K, N>(x);
+		}
+
+		/* Quantizes positions from `in` to `spatial_key_bits<K, N>` bits per axis within bounds `b` and encodes them
+		 * via `encode`, in blocks of `native_vec<K>::size()` positions. */
+		template<typename K, typename T, std::size_t N, typename A, typename F>
+		inline void spatial_keys(std::span<const basic_vec<T, N, A>> in, const basic_bounds<T, N, A> &b, std::span<K> out, F &&encode) noexcept
+		{
+			using lane_t = native_vec<K>;
+			using flane_t = vec<T, lane_t{}.size()>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = std::max(alignof(typename lane_t::simd_type), alignof(typename flane_t::simd_type));
+			constexpr auto bits = spatial_key_bits<K, N>;
+
+			SEK_ASSERT(out.size() >= in.size());
+
+			/* Coordinates are scaled to [0, 2^bits) and clamped below 2^bits, so that truncation never overflows. */
+			const auto cells = static_cast<T>(std::uint64_t{1} << bits);
+			const auto max_q = flane_t{std::nextafter(cells, T{0})};
+			flane_t bmin[N], scale[N];
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				const auto extent = b.max()[j] - b.min()[j];
+				bmin[j] = flane_t{b.min()[j]};
+				scale[j] = flane_t{extent > T{0} ? cells / extent : T{0}};
+			}
+
+			alignas(align) T buff[N][w];
+			alignas(align) K keys[w];
+			for (std::size_t i = 0; i < in.size(); i += w)
+			{
+				const auto n = std::min(w, in.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(&buff[0][0], N * w, T{0});
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t j = 0; j < N; ++j) buff[j][k] = in[i + k][j];
+
+				lane_t q[N];
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					flane_t p;
+					to_simd(p).copy_from(buff[j], dpm::vector_aligned);
+					p = sek::min(sek::max((p - bmin[j]) * scale[j], flane_t{T{0}}), max_q);
+					q[j] = lane_t{dpm::static_simd_cast<typename lane_t::simd_type>(to_simd(p))};
+				}
+
+				to_simd(encode(q)).copy_to(keys, dpm::vector_aligned);
+				std::copy_n(keys, n, out.data() + i);
+			}
+		}
+	}
+
+#pragma region "scalar key functions"
+	/** Returns the 2D Morton (Z-order) key of coordinates \a x and \a y. Only the low `spatial_key_bits<K, 2>` bits of the coordinates are used.
+	 * @note Bit `b` of \a x becomes bit `2 * b` of the key, bit `b` of \a y becomes bit `2 * b + 1`. */
+	template<std::unsigned_integral K>
+	[[nodiscard]] constexpr K morton_encode(K x, K y) noexcept
+	{
+		const K c[2] = {y, x};
+		return detail::morton_interleave<K, 2>(c);
+	}
+	/** Returns the 3D Morton (Z-order) key of coordinates \a x, \a y and \a z. Only the low `spatial_key_bits<K, 3>` bits of the coordinates are used.
+	 * @note Bit `b` of \a x becomes bit `3 * b` of the key, bit `b` of \a y becomes bit `3 * b + 1` and bit `b` of \a z becomes bit `3 * b + 2`. */
+	template<std::unsigned_integral K>
+	[[nodiscard]] constexpr K morton_encode(K x, K y, K z) noexcept
+	{
+		const K c[3] = {z, y, x};
+		return detail::morton_interleave<K, 3>(c);
+	}
+
+	/** Returns the 2D Hilbert key of coordinates \a x and \a y, using the low `Bits` bits of the coordinates. */
+	template<std::size_t Bits, std::unsigned_integral K>
+	[[nodiscard]] constexpr K hilbert_encode(K x, K y) noexcept requires (Bits != 0 && Bits <= spatial_key_bits<K, 2>)
+	{
+		constexpr auto mask = static_cast<K>((K{1} << Bits) - 1);
+		K c[2] = {x & mask, y & mask};
+		return detail::hilbert_interleave<K, 2>(c, Bits);
+	}
+	/** Returns the 3D Hilbert key of coordinates \a x, \a y and \a z, using the low `Bits` bits of the coordinates. */
+	template<std::size_t Bits, std::unsigned_integral K>
+	[[nodiscard]] constexpr K hilbert_encode(K x, K y, K z) noexcept requires (Bits != 0 && Bits <= spatial_key_bits<K, 3>)
+	{
+		constexpr auto mask = static_cast<K>((K{1} << Bits) - 1);
+		K c[3] = {x & mask, y & mask, z & mask};
+		return detail::hilbert_interleave<K, 3>(c, Bits);
+	}
+	/** Returns the 2D Hilbert key of coordinates \a x and \a y. Only the low `spatial_key_bits<K, 2>` bits of the coordinates are used. */
+	template<std::unsigned_integral K>
+	[[nodiscard]] constexpr K hilbert_encode(K x, K y) noexcept { return hilbert_encode<spatial_key_bits<K, 2>>(x, y); }
+	/** Returns the 3D Hilbert key of coordinates \a x, \a y and \a z. Only the low `spatial_key_bits<K, 3>` bits of the coordinates are used. */
+	template<std::unsigned_integral K>
+	[[nodiscard]] constexpr K hilbert_encode(K x, K y, K z) noexcept { return hilbert_encode<spatial_key_bits<K, 3>>(x, y, z); }
+#pragma endregion
+
+#pragma region "batched key functions"
+	/** Quantizes positions from \a in within bounds \a b and writes their Morton keys to \a out.
+	 * Every axis of \a b is divided into `2 ^ spatial_key_bits<K, N>` cells, positions outside of \a b are clamped to the border cells.
+	 * Equivalent to `morton_encode(qx, qy[, qz])` of the quantized coordinates for every element.
+	 * @note \a out must be at least `in.size()` elements long. Keys are computed `native_vec<K>::size()` positions at a time. */
+	template<typename K, std::floating_point T, std::size_t N, typename A>
+	inline void morton_keys(std::span<const basic_vec<T, N, A>> in, const basic_bounds<T, N, A> &b, std::span<K> out) noexcept requires (N == 2 || N == 3)
+	{
+		detail::spatial_keys(in, b, out, [](auto &q)
+		{
+			std::remove_reference_t<decltype(q[0])> rq[N];
+			for (std::size_t i = 0; i < N; ++i) rq[i] = q[N - 1 - i];
+			return detail::morton_interleave<K, N>(rq);
+		});
+	}
+	/** Quantizes positions from \a in within bounds \a b and writes their Hilbert keys to \a out.
+	 * Every axis of \a b is divided into `2 ^ spatial_key_bits<K, N>` cells, positions outside of \a b are clamped to the border cells.
+	 * Equivalent to `hilbert_encode(qx, qy[, qz])` of the quantized coordinates for every element.
+	 * @note \a out must be at least `in.size()` elements long. Keys are computed `native_vec<K>::size()` positions at a time. */
+	template<typename K, std::floating_point T, std::size_t N, typename A>
+	inline void hilbert_keys(std::span<const basic_vec<T, N, A>> in, const basic_bounds<T, N, A> &b, std::span<K> out) noexcept requires (N == 2 || N == 3)
+	{
+		detail::spatial_keys(in, b, out, [](auto &q) { return detail::hilbert_interleave<K, N>(q, spatial_key_bits<K, N>); });
+	}
+#pragma endregion
+}
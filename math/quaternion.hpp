@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "vector.hpp"
 #include "matrix.hpp"
 
@@ -24,31 +26,31 @@ namespace sek
 	private:
 		/* Making this a separate function returning a vector results in better codegen. */
 		template<std::size_t N, typename A>
-		[[nodiscard]] static inline vector_type from_matrix(const basic_mat<T, N, N, A> &x) noexcept
+		[[nodiscard]] static constexpr vector_type from_matrix(const basic_mat<T, N, N, A> &x) noexcept
 		{
 			const auto a = x[0][0] + x[1][1] + x[2][2];
 			if (const auto d = x[2][2] - x[0][0] - x[1][1]; d > a)
 			{
 				const auto max = detail::sqrt(d + T{1}) * T{0.5};
 				const auto k = T{0.25} / max;
-				return {(x[0][1] - x[1][0]) * k, (x[2][0] + x[0][2]) * k, (x[1][2] + x[2][1]) * k, max};
+				return {(x[2][0] + x[0][2]) * k, (x[1][2] + x[2][1]) * k, max, (x[0][1] - x[1][0]) * k};
 			}
 			if (const auto c = x[1][1] - x[0][0] - x[2][2]; c > a)
 			{
 				const auto max = detail::sqrt(c + T{1}) * T{0.5};
 				const auto k = T{0.25} / max;
-				return {(x[2][0] - x[0][2]) * k, (x[0][1] + x[1][0]) * k, max, (x[1][2] + x[2][1]) * k};
+				return {(x[0][1] + x[1][0]) * k, max, (x[1][2] + x[2][1]) * k, (x[2][0] - x[0][2]) * k};
 			}
 			if (const auto b = x[0][0] - x[1][1] - x[2][2]; b > a)
 			{
 				const auto max = detail::sqrt(b + T{1}) * T{0.5};
 				const auto k = T{0.25} / max;
-				return {(x[1][2] - x[2][1]) * k, max, (x[0][1] + x[1][0]) * k, (x[2][0] + x[0][2]) * k};
+				return {max, (x[0][1] + x[1][0]) * k, (x[2][0] + x[0][2]) * k, (x[1][2] - x[2][1]) * k};
 			}
 
 			const auto max = detail::sqrt(a + T{1}) * T{0.5};
 			const auto k = T{0.25} / max;
-			return {max, (x[1][2] - x[2][1]) * k, (x[2][0] - x[0][2]) * k, (x[0][1] - x[1][0]) * k};
+			return {(x[1][2] - x[2][1]) * k, (x[2][0] - x[0][2]) * k, (x[0][1] - x[1][0]) * k, max};
 		}
 
 	public:
@@ -56,7 +58,7 @@ namespace sek
 		 * @note It is recommended to use `packed_vec` if euler angles are known at compile-time
 		 * in order to enable compile-time evaluation of quaternion constants. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_quat from_euler(const basic_vec<T, 3, A> &angles) noexcept
+		[[nodiscard]] static constexpr basic_quat from_euler(const basic_vec<T, 3, A> &angles) noexcept
 		{
 			basic_vec<T, 3, A> sin_x, cos_x;
 			sincos(angles * T{0.5}, sin_x, cos_x);
@@ -74,7 +76,7 @@ namespace sek
 		 * @param angle Angle of the rotation.
 		 * @param axis Axis of the rotation. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_quat angle_axis(T angle, const basic_vec<T, 3, A> &axis) noexcept
+		[[nodiscard]] static constexpr basic_quat angle_axis(T angle, const basic_vec<T, 3, A> &axis) noexcept
 		{
 			const auto a = angle * T{0.5};
 			const auto [s, c] = detail::sincos(a);
@@ -85,7 +87,7 @@ namespace sek
 	 	 * @param dir Direction vector to rotate the origin towards.
 	 	 * @param up Normalized up vector. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static SEK_FORCEINLINE basic_quat look_at(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
+		[[nodiscard]] static constexpr SEK_FORCEINLINE basic_quat look_at(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
 		{
 #ifndef SEK_FORCE_LEFT_HANDED
 			return look_at_rh(dir, up);
@@ -97,7 +99,7 @@ namespace sek
 		 * @param dir Direction vector to rotate the origin towards.
 		 * @param up Normalized up vector. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_quat look_at_rh(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
+		[[nodiscard]] static constexpr basic_quat look_at_rh(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
 		{
 			return look_at_lh(-dir, up);
 		}
@@ -105,7 +107,7 @@ namespace sek
 		 * @param dir Direction vector to rotate the origin towards.
 		 * @param up Normalized up vector. */
 		template<typename A = math_abi::deduce_t<T, 3, Abi>>
-		[[nodiscard]] static basic_quat look_at_lh(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
+		[[nodiscard]] static constexpr basic_quat look_at_lh(const basic_vec<T, 3, A> &dir, const basic_vec<T, 3, A> &up = basic_vec<T, 3, A>::up()) noexcept
 		{
 			basic_mat<T, 3, 3, A> rot;
 			const auto right = cross(up, dir);
@@ -119,56 +121,56 @@ namespace sek
 
 		/** Initializes the quaternion from 4 components. */
 		template<typename U0, typename U1, typename U2, typename U3>
-		basic_quat(U0 x, U1 y, U2 z, U3 w) noexcept : m_vector(x, y, z, w) {}
+		constexpr basic_quat(U0 x, U1 y, U2 z, U3 w) noexcept : m_vector(x, y, z, w) {}
 		/** Initializes the quaternion from a 3D vector of imaginary parts and a scalar real part. */
 		template<typename U0, typename U1, typename A>
-		basic_quat(const basic_vec<U0, 3, A> &i, U1 r) noexcept : m_vector(i, r) {}
+		constexpr basic_quat(const basic_vec<U0, 3, A> &i, U1 r) noexcept : m_vector(i, r) {}
 		/** Initializes the quaternion from a 4D vector. */
 		template<typename U, typename A>
 		constexpr basic_quat(const basic_vec<U, 4, A> &x) noexcept : m_vector(x) {}
 
 		/** Initializes the quaternion as rotation between two normalized vectors. */
 		template<typename A>
-		basic_quat(const basic_vec<T, 3, A> &u, const basic_vec<T, 3, A> &v) noexcept;
+		constexpr basic_quat(const basic_vec<T, 3, A> &u, const basic_vec<T, 3, A> &v) noexcept;
 		/** Initializes the quaternion from a 3x3 rotation or 4x4 transform matrix. */
 		template<std::size_t N, typename A>
-		basic_quat(const basic_mat<T, N, N, A> &x) noexcept requires (N == 3 || N == 4) : m_vector(from_matrix(x)) {}
+		constexpr basic_quat(const basic_mat<T, N, N, A> &x) noexcept requires (N == 3 || N == 4) : m_vector(from_matrix(x)) {}
 
 		/** Returns reference to the `i`th element of the quaternion.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `4`. */
-		[[nodiscard]] auto &at(std::size_t i) { return m_vector.at(i); }
+		[[nodiscard]] constexpr auto &at(std::size_t i) { return m_vector.at(i); }
 		/** Returns copy of the `i`th element of the quaternion.
 		 * @param i Index of the requested element.
 		 * @throw std::range_error In case \a i exceeds `4`. */
-		[[nodiscard]] value_type at(std::size_t i) const { return m_vector.at(i); }
+		[[nodiscard]] constexpr value_type at(std::size_t i) const { return m_vector.at(i); }
 
 		/** Returns reference to the `i`th element of the quaternion.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] auto &operator[](std::size_t i) noexcept { return m_vector.operator[](i); }
+		[[nodiscard]] constexpr auto &operator[](std::size_t i) noexcept { return m_vector.operator[](i); }
 		/** Returns copy of the `i`th element of the quaternion.
 		 * @param i Index of the requested element. */
-		[[nodiscard]] value_type operator[](std::size_t i) const noexcept { return m_vector.operator[](i); }
+		[[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept { return m_vector.operator[](i); }
 
 		/** Returns reference to the first (i) component of the quaternion. */
-		[[nodiscard]] auto &x() noexcept { return m_vector.x(); }
+		[[nodiscard]] constexpr auto &x() noexcept { return m_vector.x(); }
 		/** Returns copy of the first (i) component of the quaternion. */
-		[[nodiscard]] value_type x() const noexcept { return m_vector.x(); }
+		[[nodiscard]] constexpr value_type x() const noexcept { return m_vector.x(); }
 
 		/** Returns reference to the second (j) component of the quaternion. */
-		[[nodiscard]] auto &y() noexcept { return m_vector.y(); }
+		[[nodiscard]] constexpr auto &y() noexcept { return m_vector.y(); }
 		/** Returns copy of the second (j) component of the quaternion. */
-		[[nodiscard]] value_type y() const noexcept { return m_vector.y(); }
+		[[nodiscard]] constexpr value_type y() const noexcept { return m_vector.y(); }
 
 		/** Returns reference to the third (k) component of the quaternion. */
-		[[nodiscard]] auto &z() noexcept { return m_vector.z(); }
+		[[nodiscard]] constexpr auto &z() noexcept { return m_vector.z(); }
 		/** Returns copy of the third (k) component of the quaternion. */
-		[[nodiscard]] value_type z() const noexcept { return m_vector.z(); }
+		[[nodiscard]] constexpr value_type z() const noexcept { return m_vector.z(); }
 
 		/** Returns reference to the fourth (real) component of the quaternion. */
-		[[nodiscard]] auto &w() noexcept { return m_vector.w(); }
+		[[nodiscard]] constexpr auto &w() noexcept { return m_vector.w(); }
 		/** Returns copy of the fourth (real) component of the quaternion. */
-		[[nodiscard]] value_type w() const noexcept { return m_vector.w(); }
+		[[nodiscard]] constexpr value_type w() const noexcept { return m_vector.w(); }
 
 		/** Returns a 4D vector of components of the quaternion. */
 		[[nodiscard]] constexpr const vector_type &vector() const noexcept { return m_vector; }
@@ -229,7 +231,7 @@ namespace sek
 
 	template<typename T, std::size_t NCols, std::size_t NRows, typename Abi>
 	template<typename A>
-	basic_mat<T, NCols, NRows, Abi>::basic_mat(const basic_quat<T, A> &x) noexcept requires (NCols == NRows && (NCols == 3 || NCols == 4))
+	constexpr basic_mat<T, NCols, NRows, Abi>::basic_mat(const basic_quat<T, A> &x) noexcept requires (NCols == NRows && (NCols == 3 || NCols == 4))
 	{
 		if constexpr (NCols == 4) m_data[3] = col_type{0, 0, 0, 1};
 
@@ -281,10 +283,10 @@ namespace sek
 #pragma region "geometric functions"
 	/** Calculates the dot product of quaternions \a a and \a b. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline T dot(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return dot(a.vector(), b.vector()); }
+	[[nodiscard]] constexpr T dot(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return dot(a.vector(), b.vector()); }
 	/** Calculates the cross product of quaternions \a a and \a b. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> cross(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_quat<T, Abi> cross(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept
 	{
 		const auto a333 = a.vector().www();
 		const auto b333 = b.vector().www();
@@ -302,7 +304,7 @@ namespace sek
 
 	/** Returns the normalized copy of quaternion \a x. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> normalize(const basic_quat<T, Abi> &x) noexcept
+	[[nodiscard]] constexpr basic_quat<T, Abi> normalize(const basic_quat<T, Abi> &x) noexcept
 	{
 		const auto dp = dot(x, x);
 		if (dp <= std::numeric_limits<T>::epsilon()) [[unlikely]]
@@ -311,17 +313,17 @@ namespace sek
 	}
 	/** Calculates the conjugate of quaternion \a x. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> conjugate(const basic_quat<T, Abi> &x) noexcept { return {-x.vector().xyz(), x.w()}; }
+	[[nodiscard]] constexpr basic_quat<T, Abi> conjugate(const basic_quat<T, Abi> &x) noexcept { return {-x.vector().xyz(), x.w()}; }
 	/** Calculates the inverse of quaternion \a x. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> inverse(const basic_quat<T, Abi> &x) noexcept { return conjugate(x).vector() / dot(x, x); }
+	[[nodiscard]] constexpr basic_quat<T, Abi> inverse(const basic_quat<T, Abi> &x) noexcept { return conjugate(x).vector() / dot(x, x); }
 #pragma endregion
 
 #pragma region "translation functions"
 	/** Calculates the linear interpolation between quaternions \a a and \a b using factor \a f.
 	 * @note \a f must be in range `[0, 1.0]`. */
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> lerp(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b, T f) noexcept
+	[[nodiscard]] constexpr basic_quat<T, Abi> lerp(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b, T f) noexcept
 	{
 		SEK_ASSERT(0 <= f && f <= 1.0);
 		return {a.vector() * fmsub(b.vector(), {f}, {f - T{1}})};
@@ -379,22 +381,170 @@ namespace sek
 	 * @return Quaternion rotated about the axis.
 	 * @note Rotation axis must be normalized. */
 	template<typename T, typename AQ, typename AV = math_abi::deduce_t<T, 3, AQ>>
-	[[nodiscard]] inline basic_quat<T, AQ> rotate(const basic_quat<T, AQ> &q, T a, const basic_vec<T, 3, AV> &v) noexcept
+	[[nodiscard]] constexpr basic_quat<T, AQ> rotate(const basic_quat<T, AQ> &q, T a, const basic_vec<T, 3, AV> &v) noexcept
 	{
 		return q * basic_quat<T, AQ>::angle_axis(a, v);
 	}
 #pragma endregion
 
+#pragma region "batched interpolation functions"
+	namespace detail
+	{
+		enum quat_interp_kind { interp_nlerp, interp_slerp, interp_fast_slerp };
+
+		/* Interpolates quaternions in blocks of `native_vec<T>::size()`. Components of every block are de-interleaved into lanes,
+		 * the shortest-path sign flip and the near-parallel fallback are selected per-lane via masks, and results are interleaved back.
+		 * If `fs` is null, `f0` is used as the interpolation factor for all quaternions. */
+		template<quat_interp_kind Kind, typename T, typename A>
+		inline void quat_interp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, const T *fs, T f0, std::span<basic_quat<T, A>> out) noexcept
+		{
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+
+			SEK_ASSERT(a.size() == b.size() && out.size() >= a.size());
+
+			const auto one = lane_t{T{1}};
+			const auto half = lane_t{T{0.5}};
+
+			alignas(align) T buff[2][4][w];
+			alignas(align) T f_buff[w];
+			for (std::size_t i = 0; i < a.size(); i += w)
+			{
+				const auto n = std::min(w, a.size() - i);
+				if (n < w) [[unlikely]] std::fill_n(&buff[0][0][0], 2 * 4 * w, T{0});
+
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t j = 0; j < 4; ++j)
+					{
+						buff[0][j][k] = a[i + k][j];
+						buff[1][j][k] = b[i + k][j];
+					}
+
+				lane_t qa[4], qb[4], f = lane_t{f0};
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					to_simd(qa[j]).copy_from(buff[0][j], dpm::vector_aligned);
+					to_simd(qb[j]).copy_from(buff[1][j], dpm::vector_aligned);
+				}
+				if (fs != nullptr)
+				{
+					std::copy_n(fs + i, n, f_buff);
+					to_simd(f).copy_from(f_buff, dpm::vector_aligned);
+				}
+
+				/* Flip the sign of `b` to interpolate along the shortest path. */
+				auto t = fmadd(qa[0], qb[0], fmadd(qa[1], qb[1], fmadd(qa[2], qb[2], qa[3] * qb[3])));
+				const auto s = blend(one, -one, t < lane_t{T{0}});
+				t = abs(t);
+
+				lane_t wa, wb;
+				if constexpr (Kind == interp_slerp)
+				{
+					/* Use linear interpolation when t is close to 1. */
+					const auto near = t > lane_t{T{1} - std::numeric_limits<T>::epsilon()};
+					const auto x = acos(fmin(t, one));
+					const auto k = one / sin(x);
+					wa = blend(sin(fnmadd(f, x, x)) * k, one - f, near);
+					wb = blend(sin(f * x) * k, f, near);
+				}
+				else if constexpr (Kind == interp_fast_slerp)
+				{
+					/* Correct the interpolation factor of nlerp with a polynomial fit of the slerp angular velocity. */
+					const auto ka = fmadd(t, fmadd(t, fmadd(t, lane_t{T(-1.43519)}, lane_t{T(3.55645)}), lane_t{T(-3.2452)}), lane_t{T(1.0904)});
+					const auto kb = fmadd(t, fmadd(t, lane_t{T(0.215638)}, lane_t{T(-1.06021)}), lane_t{T(0.848013)});
+					const auto fh = f - half;
+					const auto k = fmadd(ka * fh, fh, kb);
+					wb = fmadd(f * fh * (f - one), k, f);
+					wa = one - wb;
+				}
+				else
+				{
+					wa = one - f;
+					wb = f;
+				}
+
+				wb *= s;
+				lane_t r[4];
+				for (std::size_t j = 0; j < 4; ++j) r[j] = fmadd(qa[j], wa, qb[j] * wb);
+				if constexpr (Kind != interp_slerp)
+				{
+					const auto k = one / sqrt(fmadd(r[0], r[0], fmadd(r[1], r[1], fmadd(r[2], r[2], r[3] * r[3]))));
+					for (std::size_t j = 0; j < 4; ++j) r[j] *= k;
+				}
+
+				for (std::size_t j = 0; j < 4; ++j) to_simd(r[j]).copy_to(buff[0][j], dpm::vector_aligned);
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t j = 0; j < 4; ++j) out[i + k][j] = buff[0][j][k];
+			}
+		}
+	}
+
+	/** Calculates spherical linear interpolation between quaternions from \a a and \a b using factors from \a f and writes them to \a out.
+	 * Equivalent to `out[i] = slerp(a[i], b[i], f[i])` for every element `i`.
+	 * @note \a a, \a b and \a f must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b. */
+	template<typename T, typename A>
+	inline void slerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, std::span<const T> f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		SEK_ASSERT(f.size() == a.size());
+		detail::quat_interp_batch<detail::interp_slerp, T, A>(a, b, f.data(), T{0}, out);
+	}
+	/** Calculates spherical linear interpolation between quaternions from \a a and \a b using factor \a f and writes them to \a out.
+	 * Equivalent to `out[i] = slerp(a[i], b[i], f)` for every element `i`.
+	 * @note \a a and \a b must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b. */
+	template<typename T, typename A>
+	inline void slerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, T f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		detail::quat_interp_batch<detail::interp_slerp, T, A>(a, b, nullptr, f, out);
+	}
+
+	/** Calculates approximate spherical linear interpolation between quaternions from \a a and \a b using factors from \a f and writes them to \a out.
+	 * Result is a normalized linear interpolation with a polynomial correction of the interpolation factor, and does not evaluate any trigonometric functions.
+	 * @note \a a, \a b and \a f must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b.
+	 * @note Angular error of the approximation does not exceed `1e-3` radians for normalized inputs. */
+	template<typename T, typename A>
+	inline void fast_slerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, std::span<const T> f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		SEK_ASSERT(f.size() == a.size());
+		detail::quat_interp_batch<detail::interp_fast_slerp, T, A>(a, b, f.data(), T{0}, out);
+	}
+	/** Calculates approximate spherical linear interpolation between quaternions from \a a and \a b using factor \a f and writes them to \a out.
+	 * Result is a normalized linear interpolation with a polynomial correction of the interpolation factor, and does not evaluate any trigonometric functions.
+	 * @note \a a and \a b must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b.
+	 * @note Angular error of the approximation does not exceed `1e-3` radians for normalized inputs. */
+	template<typename T, typename A>
+	inline void fast_slerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, T f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		detail::quat_interp_batch<detail::interp_fast_slerp, T, A>(a, b, nullptr, f, out);
+	}
+
+	/** Calculates normalized linear interpolation along the shortest path between quaternions from \a a and \a b using factors from \a f and writes them to \a out.
+	 * @note \a a, \a b and \a f must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b. */
+	template<typename T, typename A>
+	inline void nlerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, std::span<const T> f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		SEK_ASSERT(f.size() == a.size());
+		detail::quat_interp_batch<detail::interp_nlerp, T, A>(a, b, f.data(), T{0}, out);
+	}
+	/** Calculates normalized linear interpolation along the shortest path between quaternions from \a a and \a b using factor \a f and writes them to \a out.
+	 * @note \a a and \a b must be of the same size. \a out must be at least `a.size()` elements long and may alias \a a or \a b. */
+	template<typename T, typename A>
+	inline void nlerp_batch(std::span<const basic_quat<T, A>> a, std::span<const basic_quat<T, A>> b, T f, std::span<basic_quat<T, A>> out) noexcept
+	{
+		detail::quat_interp_batch<detail::interp_nlerp, T, A>(a, b, nullptr, f, out);
+	}
+#pragma endregion
+
 	template<std::floating_point T, typename Abi>
 	template<typename A>
-	basic_quat<T, Abi>::basic_quat(const basic_vec<T, 3, A> &u, const basic_vec<T, 3, A> &v) noexcept
+	constexpr basic_quat<T, Abi>::basic_quat(const basic_vec<T, 3, A> &u, const basic_vec<T, 3, A> &v) noexcept
 	{
 		basic_vec<T, 4, Abi> t;
 
 		const auto a = detail::sqrt(dot(u, u) * dot(v, v));
 		if (const auto b = a + dot(u, v); b >= T{1.e-6} * a)
 			t = {cross(u, v), b};
-		else if (std::abs(u[0]) > std::abs(u[2]))
+		else if (const auto abs_u = abs(u); abs_u[0] > abs_u[2])
 			t = {-u[1], u[0], 0, 0};
 		else
 			t = {0, -u[2], u[1], 0};
@@ -404,21 +554,21 @@ namespace sek
 
 #pragma region "basic_quat operators"
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> operator+(const basic_quat<T, Abi> &x) noexcept { return +x.vector(); }
+	[[nodiscard]] constexpr basic_quat<T, Abi> operator+(const basic_quat<T, Abi> &x) noexcept { return +x.vector(); }
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> operator-(const basic_quat<T, Abi> &x) noexcept { return -x.vector(); }
+	[[nodiscard]] constexpr basic_quat<T, Abi> operator-(const basic_quat<T, Abi> &x) noexcept { return -x.vector(); }
 
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> operator+(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return {a.vector() + b.vector()}; }
+	[[nodiscard]] constexpr basic_quat<T, Abi> operator+(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return {a.vector() + b.vector()}; }
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> operator-(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return {a.vector() - b.vector()}; }
+	[[nodiscard]] constexpr basic_quat<T, Abi> operator-(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return {a.vector() - b.vector()}; }
 	template<typename T, typename Abi>
-	inline basic_quat<T, Abi> operator+=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a = (a + b); }
+	constexpr basic_quat<T, Abi> operator+=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a = (a + b); }
 	template<typename T, typename Abi>
-	inline basic_quat<T, Abi> operator-=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a = (a - b); }
+	constexpr basic_quat<T, Abi> operator-=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a = (a - b); }
 
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_quat<T, Abi> operator*(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept
+	[[nodiscard]] constexpr basic_quat<T, Abi> operator*(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept
 	{
 		const auto a3 = a.vector().xyz();
 		const auto b3 = b.vector().xyz();
@@ -427,10 +577,10 @@ namespace sek
 		return {fmadd(b3, {a.w()}, fmadd(a3, {b.w()}, cp)), detail::fmsub(a.w(), b.w(), dp)};
 	}
 	template<typename T, typename Abi>
-	inline basic_quat<T, Abi> &operator*=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return (a = a * b); }
+	constexpr basic_quat<T, Abi> &operator*=(basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return (a = a * b); }
 
 	template<typename T, typename AQ, typename AV = math_abi::deduce_t<T, 3, AQ>>
-	[[nodiscard]] inline basic_vec<T, 3, AV> operator*(const basic_quat<T, AQ> &a, const basic_vec<T, 3, AV> &b) noexcept
+	[[nodiscard]] constexpr basic_vec<T, 3, AV> operator*(const basic_quat<T, AQ> &a, const basic_vec<T, 3, AV> &b) noexcept
 	{
 		const auto a3 = a.vector().xyz();
 		const auto u0 = cross(a3, b);
@@ -438,17 +588,17 @@ namespace sek
 		return fmadd(fmadd(u0, {a.w()}, u1), basic_vec<T, 3, AV>{2}, b);
 	}
 	template<typename T, typename AV, typename AQ = math_abi::deduce_t<T, 4, AV>>
-	[[nodiscard]] inline basic_vec<T, 3, AV> operator*(const basic_vec<T, 3, AV> &a, const basic_quat<T, AQ> &b) noexcept { return inverse(b) * a; }
+	[[nodiscard]] constexpr basic_vec<T, 3, AV> operator*(const basic_vec<T, 3, AV> &a, const basic_quat<T, AQ> &b) noexcept { return inverse(b) * a; }
 
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_vec<T, 4, Abi> operator*(const basic_quat<T, Abi> &a, const basic_vec<T, 4, Abi> &b) noexcept { return {a * b.xyz(), b.w()}; }
+	[[nodiscard]] constexpr basic_vec<T, 4, Abi> operator*(const basic_quat<T, Abi> &a, const basic_vec<T, 4, Abi> &b) noexcept { return {a * b.xyz(), b.w()}; }
 	template<typename T, typename Abi>
-	[[nodiscard]] inline basic_vec<T, 4, Abi> operator*(const basic_vec<T, 4, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return inverse(b) * a; }
+	[[nodiscard]] constexpr basic_vec<T, 4, Abi> operator*(const basic_vec<T, 4, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return inverse(b) * a; }
 
 	template<typename T, typename Abi>
-	[[nodiscard]] inline typename basic_quat<T, Abi>::mask_type operator==(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a.vector() == b.vector(); }
+	[[nodiscard]] constexpr typename basic_quat<T, Abi>::mask_type operator==(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a.vector() == b.vector(); }
 	template<typename T, typename Abi>
-	[[nodiscard]] inline typename basic_quat<T, Abi>::mask_type operator!=(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a.vector() != b.vector(); }
+	[[nodiscard]] constexpr typename basic_quat<T, Abi>::mask_type operator!=(const basic_quat<T, Abi> &a, const basic_quat<T, Abi> &b) noexcept { return a.vector() != b.vector(); }
 #pragma endregion
 
 #pragma region "comparison functions"
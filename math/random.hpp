@@ -6,3 +6,6 @@
 
 #include "detail/sysrandom.hpp"
 #include "detail/xoroshiro.hpp"
+#include "detail/xoroshiro_simd.hpp"
+#include "detail/xoroshiro_registry.hpp"
+#include "detail/philox.hpp"
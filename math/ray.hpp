@@ -0,0 +1,270 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "bounds.hpp"
+
+namespace sek
+{
+	/** @brief Structure used to define an N-dimensional ray.
+	 *
+	 * Alongside the origin and direction, rays cache the reciprocal direction and the direction sign mask,
+	 * which are used by the slab intersection tests to avoid divisions and per-axis selection of the near & far box planes.
+	 *
+	 * @tparam T Value type of the underlying vectors.
+	 * @tparam N Dimension of the ray.
+	 * @tparam Abi ABI tag used by the underlying vectors. */
+	template<std::floating_point T, std::size_t N, typename Abi>
+	class basic_ray
+	{
+	public:
+		using vector_type = basic_vec<T, N, Abi>;
+		using value_type = T;
+
+	public:
+		constexpr basic_ray() noexcept = default;
+
+		/** Initializes the ray from origin \a org and direction \a dir.
+		 * @note \a dir does not need to be normalized, in which case intersection distances are expressed in units of \a dir. */
+		basic_ray(const vector_type &org, const vector_type &dir) noexcept : m_org(org), m_dir(dir), m_inv(vector_type{T{1}} / dir)
+		{
+			for (std::size_t i = 0; i < N; ++i) m_sign |= static_cast<std::uint32_t>(std::signbit(dir[i])) << i;
+		}
+
+		/** Returns the origin of the ray. */
+		[[nodiscard]] constexpr const vector_type &origin() const noexcept { return m_org; }
+		/** Returns the direction of the ray. */
+		[[nodiscard]] constexpr const vector_type &direction() const noexcept { return m_dir; }
+		/** Returns the reciprocal of the direction of the ray. */
+		[[nodiscard]] constexpr const vector_type &inv_direction() const noexcept { return m_inv; }
+		/** Returns the sign mask of the ray direction, where bit `i` is set if the `i`th component of the direction is negative. */
+		[[nodiscard]] constexpr std::uint32_t sign() const noexcept { return m_sign; }
+
+		/** Returns the point at distance \a t along the ray. */
+		[[nodiscard]] vector_type at(T t) const noexcept { return fmadd(m_dir, vector_type{t}, m_org); }
+
+	private:
+		vector_type m_org = {};
+		vector_type m_dir = {};
+		vector_type m_inv = {};
+		std::uint32_t m_sign = 0;
+	};
+
+	/** Interval of the ray parameter within which a ray is inside a bounding volume. */
+	template<typename T>
+	struct ray_interval
+	{
+		/** Checks if the interval is non-empty, I.e. the ray intersects the bounding volume. */
+		[[nodiscard]] constexpr bool hit() const noexcept { return tnear <= tfar; }
+
+		/** Distance along the ray at which the ray enters the bounding volume. */
+		T tnear;
+		/** Distance along the ray at which the ray exits the bounding volume. */
+		T tfar;
+	};
+
+#pragma region "basic_ray aliases"
+	/** Alias for N-dimensional ray that uses implementation-defined ABI deduced from it's type, size and optional ABI hint. */
+	template<typename T, std::size_t N, typename Abi = math_abi::fixed_size<N>>
+	using ray = basic_ray<T, N, math_abi::deduce_t<T, N, Abi>>;
+	/** Alias for 2D ray that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<2>>
+	using ray2 = ray<T, 2, Abi>;
+	/** Alias for 3D ray that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<3>>
+	using ray3 = ray<T, 3, Abi>;
+#pragma endregion
+
+	namespace detail
+	{
+		/* Stores lane hit mask `m` of `n` rays or boxes starting at index `i` into bitmask `out`. */
+		template<typename M>
+		SEK_FORCEINLINE void ray_store_bits(const M &m, std::uint64_t *out, std::size_t i, std::size_t n) noexcept
+		{
+			for (std::size_t j = 0; j < n; ++j)
+				out[(i + j) / 64] |= static_cast<std::uint64_t>(static_cast<bool>(m[j])) << ((i + j) % 64);
+		}
+	}
+
+#pragma region "intersection functions"
+	/** Intersects ray \a r with bounding volume \a b using the slab test.
+	 * @param r Ray to intersect.
+	 * @param b Bounding volume to intersect.
+	 * @param tmin Minimum distance along the ray.
+	 * @param tmax Maximum distance along the ray.
+	 * @return Interval of the ray within \a b, clamped to [\a tmin, \a tmax]. The ray hits \a b if the interval is non-empty.
+	 * @note Result is undefined if the origin of \a r lies on a slab plane parallel to the direction of \a r. */
+	template<typename T, std::size_t N, typename A>
+	[[nodiscard]] inline ray_interval<T> intersect(const basic_ray<T, N, A> &r, const basic_bounds<T, N, A> &b, T tmin = T{0}, T tmax = std::numeric_limits<T>::infinity()) noexcept
+	{
+		const auto t0 = (b.min() - r.origin()) * r.inv_direction();
+		const auto t1 = (b.max() - r.origin()) * r.inv_direction();
+		return {std::max(hmax(min(t0, t1)), tmin), std::min(hmin(max(t0, t1)), tmax)};
+	}
+
+	/** Intersects ray \a r with bounding volumes specified by minimum corners \a min and maximum corners \a max.
+	 * Equivalent to `intersect(r, {min[i], max[i]}, tmin, tmax)` for every element `i`.
+	 * @param r Ray to intersect.
+	 * @param min Minimum corners of the bounding volumes.
+	 * @param max Maximum corners of the bounding volumes.
+	 * @param tnear Span receiving the entry distances. May be empty, in which case entry distances are not stored.
+	 * @param tfar Span receiving the exit distances. May be empty, in which case exit distances are not stored.
+	 * @param hits Bitmask receiving the hit results, where bit `i % 64` of element `i / 64` is set if the ray hits volume `i`.
+	 * @param tmin Minimum distance along the ray.
+	 * @param tmax Maximum distance along the ray.
+	 * @note \a min and \a max must be of the same size, non-empty \a tnear and \a tfar must be at least `min.size()` elements long
+	 * and \a hits must be at least `(min.size() + 63) / 64` elements long. */
+	template<typename T, std::size_t N, typename A>
+	inline void intersect(const basic_ray<T, N, A> &r, const soa_array<basic_vec<T, N, A>> &min, const soa_array<basic_vec<T, N, A>> &max,
+	                      std::span<T> tnear, std::span<T> tfar, std::span<std::uint64_t> hits,
+	                      T tmin = T{0}, T tmax = std::numeric_limits<T>::infinity()) noexcept
+	{
+		using lane_t = typename soa_array<basic_vec<T, N, A>>::lane_type;
+		constexpr auto w = lane_t{}.size();
+		SEK_ASSERT(min.size() == max.size() && hits.size() * 64 >= min.size());
+		SEK_ASSERT((tnear.empty() || tnear.size() >= min.size()) && (tfar.empty() || tfar.size() >= min.size()));
+
+		/* Near & far planes of every slab are selected once per ray using the direction sign, so the per-lane
+		 * work is a single subtract & multiply per plane, followed by a min/max reduction across the axes. */
+		std::array<const T *, N> sn, sf;
+		lane_t org[N], inv[N];
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			const bool neg = r.sign() & (1u << j);
+			sn[j] = neg ? max.data(j) : min.data(j);
+			sf[j] = neg ? min.data(j) : max.data(j);
+			org[j] = lane_t{r.origin()[j]};
+			inv[j] = lane_t{r.inv_direction()[j]};
+		}
+
+		std::fill_n(hits.data(), (min.size() + 63) / 64, std::uint64_t{0});
+		for (std::size_t i = 0; i < min.size(); i += w)
+		{
+			auto tn = lane_t{tmin}, tf = lane_t{tmax};
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				tn = sek::max(tn, (detail::soa_load<lane_t>(sn[j] + i) - org[j]) * inv[j]);
+				tf = sek::min(tf, (detail::soa_load<lane_t>(sf[j] + i) - org[j]) * inv[j]);
+			}
+
+			const auto n = std::min(w, min.size() - i);
+			if (!tnear.empty()) detail::soa_store_n(tn, tnear.data() + i, n);
+			if (!tfar.empty()) detail::soa_store_n(tf, tfar.data() + i, n);
+			detail::ray_store_bits(tn <= tf, hits.data(), i, n);
+		}
+	}
+	/** Intersects ray \a r with bounding volumes \a b. Volumes are transposed to structure-of-arrays form
+	 * `native_vec<T>::size()` elements at a time. Equivalent to `intersect(r, b[i], tmin, tmax)` for every element `i`.
+	 * @copydetails intersect */
+	template<typename T, std::size_t N, typename A>
+	inline void intersect(const basic_ray<T, N, A> &r, std::span<const basic_bounds<T, N, A>> b,
+	                      std::span<T> tnear, std::span<T> tfar, std::span<std::uint64_t> hits,
+	                      T tmin = T{0}, T tmax = std::numeric_limits<T>::infinity()) noexcept
+	{
+		using lane_t = native_vec<T>;
+		constexpr auto w = lane_t{}.size();
+		constexpr auto align = alignof(typename lane_t::simd_type);
+		SEK_ASSERT(hits.size() * 64 >= b.size());
+		SEK_ASSERT((tnear.empty() || tnear.size() >= b.size()) && (tfar.empty() || tfar.size() >= b.size()));
+
+		lane_t org[N], inv[N];
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			org[j] = lane_t{r.origin()[j]};
+			inv[j] = lane_t{r.inv_direction()[j]};
+		}
+
+		/* Near & far corners are selected while transposing, using the direction sign. */
+		alignas(align) T buff[2][N][w];
+		std::fill_n(hits.data(), (b.size() + 63) / 64, std::uint64_t{0});
+		for (std::size_t i = 0; i < b.size(); i += w)
+		{
+			const auto n = std::min(w, b.size() - i);
+			if (n < w) [[unlikely]] std::fill_n(buff[0][0], 2 * N * w, T{0});
+			for (std::size_t k = 0; k < n; ++k)
+			{
+				const auto bmin = b[i + k].min(), bmax = b[i + k].max();
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					const bool neg = r.sign() & (1u << j);
+					buff[0][j][k] = neg ? bmax[j] : bmin[j];
+					buff[1][j][k] = neg ? bmin[j] : bmax[j];
+				}
+			}
+
+			auto tn = lane_t{tmin}, tf = lane_t{tmax};
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				tn = sek::max(tn, (detail::soa_load<lane_t>(buff[0][j]) - org[j]) * inv[j]);
+				tf = sek::min(tf, (detail::soa_load<lane_t>(buff[1][j]) - org[j]) * inv[j]);
+			}
+
+			if (!tnear.empty()) detail::soa_store_n(tn, tnear.data() + i, n);
+			if (!tfar.empty()) detail::soa_store_n(tf, tfar.data() + i, n);
+			detail::ray_store_bits(tn <= tf, hits.data(), i, n);
+		}
+	}
+	/** Intersects rays \a r with bounding volume \a b. Rays are transposed to structure-of-arrays form
+	 * `native_vec<T>::size()` elements at a time. Equivalent to `intersect(r[i], b, tmin, tmax)` for every element `i`.
+	 * @param r Rays to intersect.
+	 * @param b Bounding volume to intersect.
+	 * @param tnear Span receiving the entry distances. May be empty, in which case entry distances are not stored.
+	 * @param tfar Span receiving the exit distances. May be empty, in which case exit distances are not stored.
+	 * @param hits Bitmask receiving the hit results, where bit `i % 64` of element `i / 64` is set if ray `i` hits the volume.
+	 * @param tmin Minimum distance along the rays.
+	 * @param tmax Maximum distance along the rays.
+	 * @note Non-empty \a tnear and \a tfar must be at least `r.size()` elements long and \a hits must be at least `(r.size() + 63) / 64` elements long. */
+	template<typename T, std::size_t N, typename A>
+	inline void intersect(std::span<const basic_ray<T, N, A>> r, const basic_bounds<T, N, A> &b,
+	                      std::span<T> tnear, std::span<T> tfar, std::span<std::uint64_t> hits,
+	                      T tmin = T{0}, T tmax = std::numeric_limits<T>::infinity()) noexcept
+	{
+		using lane_t = native_vec<T>;
+		constexpr auto w = lane_t{}.size();
+		constexpr auto align = alignof(typename lane_t::simd_type);
+		SEK_ASSERT(hits.size() * 64 >= r.size());
+		SEK_ASSERT((tnear.empty() || tnear.size() >= r.size()) && (tfar.empty() || tfar.size() >= r.size()));
+
+		lane_t bmin[N], bmax[N];
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			bmin[j] = lane_t{b.min()[j]};
+			bmax[j] = lane_t{b.max()[j]};
+		}
+
+		/* Box planes are shared by all lanes, so near & far planes are selected per-lane from both slab distances. */
+		alignas(align) T buff[2][N][w];
+		std::fill_n(hits.data(), (r.size() + 63) / 64, std::uint64_t{0});
+		for (std::size_t i = 0; i < r.size(); i += w)
+		{
+			const auto n = std::min(w, r.size() - i);
+			if (n < w) [[unlikely]] std::fill_n(buff[0][0], 2 * N * w, T{0});
+			for (std::size_t k = 0; k < n; ++k)
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					buff[0][j][k] = r[i + k].origin()[j];
+					buff[1][j][k] = r[i + k].inv_direction()[j];
+				}
+
+			auto tn = lane_t{tmin}, tf = lane_t{tmax};
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				const auto org = detail::soa_load<lane_t>(buff[0][j]);
+				const auto inv = detail::soa_load<lane_t>(buff[1][j]);
+				const auto t0 = (bmin[j] - org) * inv;
+				const auto t1 = (bmax[j] - org) * inv;
+				tn = sek::max(tn, sek::min(t0, t1));
+				tf = sek::min(tf, sek::max(t0, t1));
+			}
+
+			if (!tnear.empty()) detail::soa_store_n(tn, tnear.data() + i, n);
+			if (!tfar.empty()) detail::soa_store_n(tf, tfar.data() + i, n);
+			detail::ray_store_bits(tn <= tf, hits.data(), i, n);
+		}
+	}
+#pragma endregion
+}
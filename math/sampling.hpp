@@ -0,0 +1,296 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <array>
+#include <numbers>
+#include <random>
+
+#include "quaternion.hpp"
+#include "bounds.hpp"
+#include "random.hpp"
+
+namespace sek
+{
+	namespace detail
+	{
+		/* Returns a random floating-point value within [0, 1) generated by `g`. */
+		template<std::floating_point T, typename G>
+		[[nodiscard]] inline T random_unit(G &g) noexcept
+		{
+			using R = typename G::result_type;
+			if constexpr (std::floating_point<R> && requires(std::span<T> s) { g.generate_uniform(s, T{0}, T{1}); })
+			{
+				/* xoroshiro engines generate floating-point values within [0, 1). */
+				if constexpr (std::same_as<R, T>)
+					return g();
+				else
+				{
+					T result;
+					g.generate_uniform(std::span<T>{&result, 1}, T{0}, T{1});
+					return result;
+				}
+			}
+			else if constexpr (std::unsigned_integral<R> && G::min() == 0 && G::max() == std::numeric_limits<R>::max() &&
+			                   std::numeric_limits<R>::digits >= std::numeric_limits<T>::digits)
+			{
+				constexpr auto digits = std::numeric_limits<T>::digits;
+				return static_cast<T>(g() >> (std::numeric_limits<R>::digits - digits)) * (T{1} / static_cast<T>(R{1} << digits));
+			}
+			else
+				return std::generate_canonical<T, std::numeric_limits<T>::digits>(g);
+		}
+		/* Writes `n` random floating-point values within [0, 1) generated by `g` to `out`. */
+		template<std::floating_point T, typename G>
+		inline void random_units(G &g, T *out, std::size_t n) noexcept
+		{
+			if constexpr (requires(std::span<T> s) { g.generate_uniform(s, T{0}, T{1}); })
+				g.generate_uniform(std::span<T>{out, n}, T{0}, T{1});
+			else
+				for (std::size_t i = 0; i < n; ++i) out[i] = random_unit<T>(g);
+		}
+
+		/* Samplers map `inputs` uniform values within [0, 1) to `outputs` components of the result. Every sampler is
+		 * branch-free and is used both for scalar and lane-parallel (`native_vec<T>`) evaluation. */
+		template<typename T, std::size_t N, typename A>
+		struct sample_bounds
+		{
+			constexpr static std::size_t inputs = N;
+			constexpr static std::size_t outputs = N;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[N], L (&r)[N]) const noexcept
+			{
+				for (std::size_t i = 0; i < N; ++i) r[i] = u[i] * L{size[i]} + L{min[i]};
+			}
+
+			basic_vec<T, N, A> min;
+			basic_vec<T, N, A> size;
+		};
+		template<typename T>
+		struct sample_sphere
+		{
+			constexpr static std::size_t inputs = 2;
+			constexpr static std::size_t outputs = 3;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[2], L (&r)[3]) const noexcept
+			{
+				using std::sqrt, std::sin, std::cos;
+
+				const auto z = L{T{1}} - u[0] * L{T{2}};
+				const auto k = sqrt(L{T{1}} - z * z);
+				const auto phi = u[1] * L{std::numbers::pi_v<T> * T{2}};
+				r[0] = k * cos(phi);
+				r[1] = k * sin(phi);
+				r[2] = z;
+			}
+		};
+		template<typename T>
+		struct sample_hemisphere
+		{
+			constexpr static std::size_t inputs = 2;
+			constexpr static std::size_t outputs = 3;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[2], L (&r)[3]) const noexcept
+			{
+				using std::sqrt, std::sin, std::cos;
+
+				const auto k = sqrt(L{T{1}} - u[0] * u[0]);
+				const auto phi = u[1] * L{std::numbers::pi_v<T> * T{2}};
+				r[0] = k * cos(phi);
+				r[1] = k * sin(phi);
+				r[2] = u[0];
+			}
+		};
+		template<typename T>
+		struct sample_cosine_hemisphere
+		{
+			constexpr static std::size_t inputs = 2;
+			constexpr static std::size_t outputs = 3;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[2], L (&r)[3]) const noexcept
+			{
+				using std::sqrt, std::sin, std::cos;
+
+				/* Malley's method, points of the unit disc are projected onto the hemisphere. */
+				const auto k = sqrt(u[0]);
+				const auto phi = u[1] * L{std::numbers::pi_v<T> * T{2}};
+				r[0] = k * cos(phi);
+				r[1] = k * sin(phi);
+				r[2] = sqrt(L{T{1}} - u[0]);
+			}
+		};
+		template<typename T>
+		struct sample_disc
+		{
+			constexpr static std::size_t inputs = 2;
+			constexpr static std::size_t outputs = 2;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[2], L (&r)[2]) const noexcept
+			{
+				using std::sqrt, std::sin, std::cos;
+
+				const auto k = sqrt(u[0]);
+				const auto phi = u[1] * L{std::numbers::pi_v<T> * T{2}};
+				r[0] = k * cos(phi);
+				r[1] = k * sin(phi);
+			}
+		};
+		template<typename T>
+		struct sample_quat
+		{
+			constexpr static std::size_t inputs = 3;
+			constexpr static std::size_t outputs = 4;
+
+			template<typename L>
+			SEK_FORCEINLINE void operator()(const L (&u)[3], L (&r)[4]) const noexcept
+			{
+				using std::sqrt, std::sin, std::cos;
+
+				/* Shoemake, "Uniform random rotations" (Graphics Gems III). */
+				const auto k0 = sqrt(L{T{1}} - u[0]);
+				const auto k1 = sqrt(u[0]);
+				const auto phi0 = u[1] * L{std::numbers::pi_v<T> * T{2}};
+				const auto phi1 = u[2] * L{std::numbers::pi_v<T> * T{2}};
+				r[0] = k0 * sin(phi0);
+				r[1] = k0 * cos(phi0);
+				r[2] = k1 * sin(phi1);
+				r[3] = k1 * cos(phi1);
+			}
+		};
+
+		template<typename T, typename S, typename G>
+		[[nodiscard]] SEK_FORCEINLINE std::array<T, S::outputs> sample_one(G &g, const S &s) noexcept
+		{
+			T u[S::inputs], r[S::outputs];
+			random_units(g, u, S::inputs);
+			s(u, r);
+			return std::to_array(r);
+		}
+		/* Generates `n` samples in blocks of `native_vec<T>::size()`. Uniform values of every block are generated in bulk,
+		 * transposed into lanes, mapped lane-parallel and passed to `store` as `store(i, std::array<T, S::outputs>)`. */
+		template<typename T, typename S, typename G, typename F>
+		inline void sample_batch(G &g, const S &s, std::size_t n, F &&store) noexcept
+		{
+			using lane_t = native_vec<T>;
+			constexpr auto w = lane_t{}.size();
+			constexpr auto align = alignof(typename lane_t::simd_type);
+			constexpr auto ni = S::inputs;
+			constexpr auto no = S::outputs;
+
+			T ubuff[w * ni];
+			alignas(align) T buff[std::max(ni, no)][w];
+			for (std::size_t i = 0; i < n; i += w)
+			{
+				const auto k = std::min(w, n - i);
+				if (k < w) [[unlikely]] std::fill_n(&buff[0][0], std::max(ni, no) * w, T{0});
+
+				random_units(g, ubuff, k * ni);
+				for (std::size_t j = 0; j < k; ++j)
+					for (std::size_t c = 0; c < ni; ++c) buff[c][j] = ubuff[j * ni + c];
+
+				lane_t u[ni], r[no];
+				for (std::size_t c = 0; c < ni; ++c) to_simd(u[c]).copy_from(buff[c], dpm::vector_aligned);
+				s(u, r);
+				for (std::size_t c = 0; c < no; ++c) to_simd(r[c]).copy_to(buff[c], dpm::vector_aligned);
+
+				for (std::size_t j = 0; j < k; ++j)
+				{
+					std::array<T, no> result;
+					for (std::size_t c = 0; c < no; ++c) result[c] = buff[c][j];
+					store(i + j, result);
+				}
+			}
+		}
+	}
+
+#pragma region "geometric sampling functions"
+	/** Returns a random point uniformly distributed within bounding volume \a b, generated using random number generator \a g. */
+	template<std::floating_point T, std::size_t N, typename A, typename G>
+	[[nodiscard]] inline basic_vec<T, N, A> random_in_bounds(G &g, const basic_bounds<T, N, A> &b) noexcept
+	{
+		return std::make_from_tuple<basic_vec<T, N, A>>(detail::sample_one<T>(g, detail::sample_bounds<T, N, A>{b.min(), b.size()}));
+	}
+	/** Fills \a out with random points uniformly distributed within bounding volume \a b, generated using random number generator \a g. */
+	template<std::floating_point T, std::size_t N, typename A, typename G>
+	inline void random_in_bounds(G &g, const basic_bounds<T, N, A> &b, std::span<basic_vec<T, N, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_bounds<T, N, A>{b.min(), b.size()}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_vec<T, N, A>>(r); });
+	}
+
+	/** Returns a random direction uniformly distributed on the surface of the unit sphere, generated using random number generator \a g. */
+	template<std::floating_point T, typename Abi = math_abi::fixed_size<3>, typename G>
+	[[nodiscard]] inline vec3<T, Abi> random_on_sphere(G &g) noexcept
+	{
+		return std::make_from_tuple<vec3<T, Abi>>(detail::sample_one<T>(g, detail::sample_sphere<T>{}));
+	}
+	/** Fills \a out with random directions uniformly distributed on the surface of the unit sphere, generated using random number generator \a g. */
+	template<std::floating_point T, typename A, typename G>
+	inline void random_on_sphere(G &g, std::span<basic_vec<T, 3, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_sphere<T>{}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_vec<T, 3, A>>(r); });
+	}
+
+	/** Returns a random direction uniformly distributed on the surface of the unit hemisphere oriented along the positive Z axis,
+	 * generated using random number generator \a g. */
+	template<std::floating_point T, typename Abi = math_abi::fixed_size<3>, typename G>
+	[[nodiscard]] inline vec3<T, Abi> random_on_hemisphere(G &g) noexcept
+	{
+		return std::make_from_tuple<vec3<T, Abi>>(detail::sample_one<T>(g, detail::sample_hemisphere<T>{}));
+	}
+	/** Fills \a out with random directions uniformly distributed on the surface of the unit hemisphere oriented along the
+	 * positive Z axis, generated using random number generator \a g. */
+	template<std::floating_point T, typename A, typename G>
+	inline void random_on_hemisphere(G &g, std::span<basic_vec<T, 3, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_hemisphere<T>{}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_vec<T, 3, A>>(r); });
+	}
+
+	/** Returns a random cosine-weighted direction on the surface of the unit hemisphere oriented along the positive Z axis,
+	 * generated using random number generator \a g. Probability density of the result is proportional to it's Z component. */
+	template<std::floating_point T, typename Abi = math_abi::fixed_size<3>, typename G>
+	[[nodiscard]] inline vec3<T, Abi> random_cosine_hemisphere(G &g) noexcept
+	{
+		return std::make_from_tuple<vec3<T, Abi>>(detail::sample_one<T>(g, detail::sample_cosine_hemisphere<T>{}));
+	}
+	/** Fills \a out with random cosine-weighted directions on the surface of the unit hemisphere oriented along the positive
+	 * Z axis, generated using random number generator \a g. Probability density of the result is proportional to it's Z component. */
+	template<std::floating_point T, typename A, typename G>
+	inline void random_cosine_hemisphere(G &g, std::span<basic_vec<T, 3, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_cosine_hemisphere<T>{}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_vec<T, 3, A>>(r); });
+	}
+
+	/** Returns a random point uniformly distributed within the unit disc, generated using random number generator \a g. */
+	template<std::floating_point T, typename Abi = math_abi::fixed_size<2>, typename G>
+	[[nodiscard]] inline vec2<T, Abi> random_in_disc(G &g) noexcept
+	{
+		return std::make_from_tuple<vec2<T, Abi>>(detail::sample_one<T>(g, detail::sample_disc<T>{}));
+	}
+	/** Fills \a out with random points uniformly distributed within the unit disc, generated using random number generator \a g. */
+	template<std::floating_point T, typename A, typename G>
+	inline void random_in_disc(G &g, std::span<basic_vec<T, 2, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_disc<T>{}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_vec<T, 2, A>>(r); });
+	}
+
+	/** Returns a random uniformly distributed unit quaternion (rotation), generated using random number generator \a g. */
+	template<std::floating_point T, typename Abi = math_abi::fixed_size<4>, typename G>
+	[[nodiscard]] inline quat<T, Abi> random_quat(G &g) noexcept
+	{
+		return std::make_from_tuple<quat<T, Abi>>(detail::sample_one<T>(g, detail::sample_quat<T>{}));
+	}
+	/** Fills \a out with random uniformly distributed unit quaternions (rotations), generated using random number generator \a g. */
+	template<std::floating_point T, typename A, typename G>
+	inline void random_quat(G &g, std::span<basic_quat<T, A>> out) noexcept
+	{
+		detail::sample_batch<T>(g, detail::sample_quat<T>{}, out.size(), [&](std::size_t i, const auto &r) { out[i] = std::make_from_tuple<basic_quat<T, A>>(r); });
+	}
+#pragma endregion
+}
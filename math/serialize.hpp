@@ -0,0 +1,232 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <array>
+#include <span>
+#include <bit>
+
+#include "quaternion.hpp"
+#include "bounds.hpp"
+#include "random.hpp"
+
+namespace sek
+{
+	/** Byte order of serialized data. Serialized data is converted from and to the native byte order as needed. */
+	inline constexpr std::endian serial_endian = std::endian::little;
+
+	/** @brief Concept satisfied by types that can be serialized via `serialize` & `deserialize`.
+	 *
+	 * A serializable type `T` must specialize `serial_traits<T>` with the following members:
+	 * <ul>
+	 * <li>`value_type` - arithmetic type of the serialized elements.</li>
+	 * <li>`size` - static number of serialized elements.</li>
+	 * <li>`store(const T &, value_type *)` - static function writing `size` elements of the object to a buffer.</li>
+	 * <li>`load(T &, const value_type *)` - static function reading `size` elements of the object from a buffer.</li>
+	 * </ul> */
+	template<typename T>
+	concept serializable = requires(const T &a, T &b, typename serial_traits<T>::value_type *p)
+	{
+		requires std::is_arithmetic_v<typename serial_traits<T>::value_type>;
+		{ serial_traits<T>::size } -> std::convertible_to<std::size_t>;
+		serial_traits<T>::store(a, p);
+		serial_traits<T>::load(b, p);
+	};
+
+	/** Size of the serialized representation of type `T` in bytes. */
+	template<serializable T>
+	inline constexpr std::size_t serialized_size_v = serial_traits<T>::size * sizeof(typename serial_traits<T>::value_type);
+
+	namespace detail
+	{
+		template<typename T>
+		[[nodiscard]] constexpr T serial_byteswap(T x) noexcept
+		{
+			auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(x);
+			std::ranges::reverse(bytes);
+			return std::bit_cast<T>(bytes);
+		}
+
+		template<typename T>
+		inline void serial_store(std::byte *dst, const T *src, std::size_t n) noexcept
+		{
+			if constexpr (std::endian::native == serial_endian || sizeof(T) == 1)
+				std::memcpy(dst, src, n * sizeof(T));
+			else
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					const auto value = serial_byteswap(src[i]);
+					std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+				}
+		}
+		template<typename T>
+		inline void serial_load(T *dst, const std::byte *src, std::size_t n) noexcept
+		{
+			std::memcpy(dst, src, n * sizeof(T));
+			if constexpr (std::endian::native != serial_endian && sizeof(T) != 1)
+				for (std::size_t i = 0; i < n; ++i) dst[i] = serial_byteswap(dst[i]);
+		}
+
+		/* Number of elements staged in a local buffer by the bulk functions before being written in one go. */
+		template<typename T>
+		inline constexpr std::size_t serial_batch = std::max<std::size_t>(1, 1024 / serialized_size_v<T>);
+	}
+
+#pragma region "serialization functions"
+	/** Serializes \a x into buffer \a dst. Data is written packed (without SIMD padding) in `serial_endian` byte order.
+	 * @return Amount of bytes written, or `0` if \a dst is too small. */
+	template<serializable T>
+	inline std::size_t serialize(const T &x, std::span<std::byte> dst) noexcept
+	{
+		using traits_t = serial_traits<T>;
+		if (dst.size() < serialized_size_v<T>) [[unlikely]] return 0;
+
+		typename traits_t::value_type buff[traits_t::size];
+		traits_t::store(x, buff);
+		detail::serial_store(dst.data(), buff, traits_t::size);
+		return serialized_size_v<T>;
+	}
+	/** Serializes elements of \a x into buffer \a dst. Equivalent to serializing every element of \a x in order.
+	 * @return Amount of bytes written, or `0` if \a dst is too small. */
+	template<serializable T>
+	inline std::size_t serialize(std::span<const T> x, std::span<std::byte> dst) noexcept
+	{
+		using traits_t = serial_traits<T>;
+		constexpr auto batch = detail::serial_batch<T>;
+		if (dst.size() < x.size() * serialized_size_v<T>) [[unlikely]] return 0;
+
+		typename traits_t::value_type buff[batch * traits_t::size];
+		for (std::size_t i = 0; i < x.size(); i += batch)
+		{
+			const auto n = std::min(batch, x.size() - i);
+			for (std::size_t j = 0; j < n; ++j) traits_t::store(x[i + j], buff + j * traits_t::size);
+			detail::serial_store(dst.data() + i * serialized_size_v<T>, buff, n * traits_t::size);
+		}
+		return x.size() * serialized_size_v<T>;
+	}
+
+	/** Deserializes \a x from buffer \a src. Data is expected to be packed (without SIMD padding) in `serial_endian` byte order.
+	 * @return Amount of bytes read, or `0` if \a src is too small. */
+	template<serializable T>
+	inline std::size_t deserialize(T &x, std::span<const std::byte> src) noexcept
+	{
+		using traits_t = serial_traits<T>;
+		if (src.size() < serialized_size_v<T>) [[unlikely]] return 0;
+
+		typename traits_t::value_type buff[traits_t::size];
+		detail::serial_load(buff, src.data(), traits_t::size);
+		traits_t::load(x, buff);
+		return serialized_size_v<T>;
+	}
+	/** Deserializes elements of \a x from buffer \a src. Equivalent to deserializing every element of \a x in order.
+	 * @return Amount of bytes read, or `0` if \a src is too small. */
+	template<serializable T>
+	inline std::size_t deserialize(std::span<T> x, std::span<const std::byte> src) noexcept
+	{
+		using traits_t = serial_traits<T>;
+		constexpr auto batch = detail::serial_batch<T>;
+		if (src.size() < x.size() * serialized_size_v<T>) [[unlikely]] return 0;
+
+		typename traits_t::value_type buff[batch * traits_t::size];
+		for (std::size_t i = 0; i < x.size(); i += batch)
+		{
+			const auto n = std::min(batch, x.size() - i);
+			detail::serial_load(buff, src.data() + i * serialized_size_v<T>, n * traits_t::size);
+			for (std::size_t j = 0; j < n; ++j) traits_t::load(x[i + j], buff + j * traits_t::size);
+		}
+		return x.size() * serialized_size_v<T>;
+	}
+#pragma endregion
+
+#pragma region "serial_traits specializations"
+	template<typename T, std::size_t N, typename Abi>
+	struct serial_traits<basic_vec<T, N, Abi>>
+	{
+		using value_type = T;
+		constexpr static std::size_t size = N;
+
+		static void store(const basic_vec<T, N, Abi> &x, T *out) noexcept { for (std::size_t i = 0; i < N; ++i) out[i] = x[i]; }
+		static void load(basic_vec<T, N, Abi> &x, const T *in) noexcept { for (std::size_t i = 0; i < N; ++i) x[i] = in[i]; }
+	};
+	/** Matrices are serialized in column-major order. */
+	template<typename T, std::size_t NCols, std::size_t NRows, typename Abi>
+	struct serial_traits<basic_mat<T, NCols, NRows, Abi>>
+	{
+		using value_type = T;
+		constexpr static std::size_t size = NCols * NRows;
+
+		static void store(const basic_mat<T, NCols, NRows, Abi> &x, T *out) noexcept
+		{
+			for (std::size_t c = 0; c < NCols; ++c)
+				for (std::size_t r = 0; r < NRows; ++r) out[c * NRows + r] = x[c][r];
+		}
+		static void load(basic_mat<T, NCols, NRows, Abi> &x, const T *in) noexcept
+		{
+			for (std::size_t c = 0; c < NCols; ++c)
+				for (std::size_t r = 0; r < NRows; ++r) x[c][r] = in[c * NRows + r];
+		}
+	};
+	/** Quaternions are serialized in `x, y, z, w` order. */
+	template<typename T, typename Abi>
+	struct serial_traits<basic_quat<T, Abi>>
+	{
+		using value_type = T;
+		constexpr static std::size_t size = 4;
+
+		static void store(const basic_quat<T, Abi> &x, T *out) noexcept { for (std::size_t i = 0; i < 4; ++i) out[i] = x[i]; }
+		static void load(basic_quat<T, Abi> &x, const T *in) noexcept { x = basic_quat<T, Abi>{in[0], in[1], in[2], in[3]}; }
+	};
+	/** Bounding volumes are serialized as the minimum point followed by the maximum point. */
+	template<typename T, std::size_t N, typename Abi>
+	struct serial_traits<basic_bounds<T, N, Abi>>
+	{
+		using value_type = T;
+		constexpr static std::size_t size = N * 2;
+
+		static void store(const basic_bounds<T, N, Abi> &x, T *out) noexcept
+		{
+			serial_traits<basic_vec<T, N, Abi>>::store(x.min(), out);
+			serial_traits<basic_vec<T, N, Abi>>::store(x.max(), out + N);
+		}
+		static void load(basic_bounds<T, N, Abi> &x, const T *in) noexcept
+		{
+			basic_vec<T, N, Abi> min, max;
+			serial_traits<basic_vec<T, N, Abi>>::load(min, in);
+			serial_traits<basic_vec<T, N, Abi>>::load(max, in + N);
+			x = basic_bounds<T, N, Abi>{min, max};
+		}
+	};
+
+	template<typename T, std::size_t Width>
+	struct serial_traits<xoroshiro<T, Width>>
+	{
+		using value_type = typename xoroshiro<T, Width>::seed_type;
+		constexpr static std::size_t size = Width / std::numeric_limits<value_type>::digits;
+
+		static void store(const xoroshiro<T, Width> &x, value_type *out) noexcept { std::copy_n(std::begin(x.state()), size, out); }
+		static void load(xoroshiro<T, Width> &x, const value_type *in) noexcept { std::copy_n(in, size, std::begin(x.state())); }
+	};
+	/** Multi-lane engines are serialized as consecutive state words, where every word is stored for all lanes. */
+	template<typename T, std::size_t Width, std::size_t Lanes>
+	struct serial_traits<xoroshiro_simd<T, Width, Lanes>>
+	{
+		using value_type = typename xoroshiro_simd<T, Width, Lanes>::seed_type;
+		constexpr static std::size_t size = Width / std::numeric_limits<value_type>::digits * Lanes;
+
+		static void store(const xoroshiro_simd<T, Width, Lanes> &x, value_type *out) noexcept
+		{
+			for (std::size_t j = 0; j < size / Lanes; ++j)
+				for (std::size_t i = 0; i < Lanes; ++i) out[j * Lanes + i] = x.m_state[j][i];
+		}
+		static void load(xoroshiro_simd<T, Width, Lanes> &x, const value_type *in) noexcept
+		{
+			for (std::size_t j = 0; j < size / Lanes; ++j)
+				for (std::size_t i = 0; i < Lanes; ++i) x.m_state[j][i] = in[j * Lanes + i];
+		}
+	};
+#pragma endregion
+}
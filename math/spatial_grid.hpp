@@ -0,0 +1,248 @@
+/*
+ * Created by switchblade on 2026-10-16.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <array>
+#include <span>
+#include <bit>
+
+#include "detail/parallel.hpp"
+#include "bounds.hpp"
+
+namespace sek
+{
+	/** @brief Spatial hash broad phase over N-dimensional bounding volumes.
+	 *
+	 * Space is divided into a uniform grid of cubic cells, and every volume is inserted into all cells it overlaps.
+	 * Cells are hashed into a fixed number of buckets, so the grid is unbounded and it's memory use depends only on the number of volumes.
+	 * Entries are stored in flat arrays sorted by bucket via a parallel counting sort, which makes rebuilds cheap enough
+	 * to be done every frame.
+	 *
+	 * Overlap pairs & region queries report every volume once, even if it shares multiple cells with the other volume.
+	 * A pair is only reported from the first (minimum) cell of the overlap of the cell ranges of both volumes.
+	 *
+	 * @tparam T Value type of the bounding volumes.
+	 * @tparam N Dimension of the bounding volumes.
+	 * @tparam Abi ABI tag of the bounding volumes. */
+	template<std::floating_point T, std::size_t N, typename Abi>
+	class basic_spatial_grid
+	{
+	public:
+		using value_type = T;
+		using bounds_type = basic_bounds<T, N, Abi>;
+		using vector_type = basic_vec<T, N, Abi>;
+		using cell_type = std::array<std::int32_t, N>;
+
+		/** Minimum number of volumes processed by a single thread during a rebuild. */
+		constexpr static std::size_t parallel_grain = 8192;
+
+	private:
+		struct entry
+		{
+			std::uint32_t index;
+			cell_type cell;
+		};
+
+		[[nodiscard]] cell_type cell_of(const vector_type &p) const noexcept
+		{
+			cell_type result;
+			for (std::size_t i = 0; i < N; ++i) result[i] = static_cast<std::int32_t>(std::floor(p[i] * m_inv_cell));
+			return result;
+		}
+		[[nodiscard]] std::size_t bucket_of(const cell_type &c) const noexcept
+		{
+			constexpr std::uint32_t primes[3] = {73856093u, 19349663u, 83492791u};
+			std::uint32_t h = 0;
+			for (std::size_t i = 0; i < N; ++i) h ^= static_cast<std::uint32_t>(c[i]) * primes[i % 3];
+			return h & (m_offsets.size() - 2);
+		}
+
+		/* Invokes `f(cell)` for every cell within the inclusive range [min, max]. */
+		template<typename F>
+		static void for_each_cell(const cell_type &min, const cell_type &max, F &&f)
+		{
+			auto c = min;
+			for (;;)
+			{
+				f(c);
+				std::size_t i = 0;
+				for (; i < N; ++i)
+				{
+					if (c[i]++ < max[i]) break;
+					c[i] = min[i];
+				}
+				if (i == N) return;
+			}
+		}
+		[[nodiscard]] static cell_type cell_max(const cell_type &a, const cell_type &b) noexcept
+		{
+			cell_type result;
+			for (std::size_t i = 0; i < N; ++i) result[i] = std::max(a[i], b[i]);
+			return result;
+		}
+		[[nodiscard]] static bool overlaps(const bounds_type &a, const bounds_type &b) noexcept
+		{
+			return all_of(a.min() <= b.max()) && all_of(a.max() >= b.min());
+		}
+
+	public:
+		/** Initializes an empty grid with cell size \a cell_size.
+		 * @note For best performance, cell size should be comparable to the typical size of the volumes. */
+		explicit basic_spatial_grid(T cell_size) noexcept : m_cell(cell_size), m_inv_cell(T{1} / cell_size)
+		{
+			SEK_ASSERT(cell_size > T{0});
+		}
+		/** Initializes the grid with cell size \a cell_size and builds it from volumes \a bounds. */
+		basic_spatial_grid(T cell_size, std::span<const bounds_type> bounds) : basic_spatial_grid(cell_size) { build(bounds); }
+
+		/** Returns the cell size of the grid. */
+		[[nodiscard]] constexpr T cell_size() const noexcept { return m_cell; }
+		/** Returns the number of volumes in the grid. */
+		[[nodiscard]] std::size_t size() const noexcept { return m_bounds.size(); }
+		/** Checks if the grid is empty. */
+		[[nodiscard]] bool empty() const noexcept { return m_bounds.empty(); }
+		/** Returns the number of cell entries of all volumes in the grid. */
+		[[nodiscard]] std::size_t entry_count() const noexcept { return m_entries.size(); }
+
+		/** Rebuilds the grid from volumes \a bounds. Index of every volume is it's position within \a bounds.
+		 * @note Volumes are binned in parallel if the grid contains at least `2 * parallel_grain` volumes. */
+		void build(std::span<const bounds_type> bounds)
+		{
+			SEK_ASSERT(bounds.size() < std::numeric_limits<std::uint32_t>::max());
+
+			const auto n = bounds.size();
+			const auto n_buckets = std::bit_ceil(std::max<std::size_t>(n * 2, 64));
+			const auto n_chunks = detail::parallel_chunk_count(n, parallel_grain);
+
+			m_bounds.assign(bounds.begin(), bounds.end());
+			m_min_cell.resize(n);
+			m_max_cell.resize(n);
+			m_offsets.assign(n_buckets + 1, 0);
+
+			/* Count entries of every bucket per chunk, so that chunks can be scattered independently & deterministically. */
+			std::vector<std::uint32_t> counts(n_chunks * n_buckets, 0);
+			detail::parallel_chunks(n, n_chunks, [&](std::size_t c, std::size_t first, std::size_t last)
+			{
+				const auto chunk_counts = counts.data() + c * n_buckets;
+				for (auto i = first; i < last; ++i)
+				{
+					m_min_cell[i] = cell_of(bounds[i].min());
+					m_max_cell[i] = cell_of(bounds[i].max());
+					for_each_cell(m_min_cell[i], m_max_cell[i], [&](const cell_type &cell) { ++chunk_counts[bucket_of(cell)]; });
+				}
+			});
+
+			/* Exclusive prefix sum over buckets, where entries of a bucket are ordered by chunk. */
+			std::uint32_t total = 0;
+			for (std::size_t b = 0; b < n_buckets; ++b)
+			{
+				m_offsets[b] = total;
+				for (std::size_t c = 0; c < n_chunks; ++c)
+				{
+					const auto count = counts[c * n_buckets + b];
+					counts[c * n_buckets + b] = total;
+					total += count;
+				}
+			}
+			m_offsets[n_buckets] = total;
+
+			m_entries.resize(total);
+			detail::parallel_chunks(n, n_chunks, [&](std::size_t c, std::size_t first, std::size_t last)
+			{
+				const auto cursors = counts.data() + c * n_buckets;
+				for (auto i = first; i < last; ++i)
+					for_each_cell(m_min_cell[i], m_max_cell[i], [&](const cell_type &cell)
+					{
+						m_entries[cursors[bucket_of(cell)]++] = {static_cast<std::uint32_t>(i), cell};
+					});
+			});
+		}
+
+		/** Invokes \a f with indices `(a, b)` of every pair of overlapping volumes, where `a < b`. Every pair is reported exactly once. */
+		template<typename F>
+		void find_pairs(F &&f) const
+		{
+			for (std::size_t b = 0; b + 1 < m_offsets.size(); ++b)
+			{
+				const auto first = m_offsets[b], last = m_offsets[b + 1];
+				for (auto i = first; i < last; ++i)
+					for (auto j = i + 1; j < last; ++j)
+					{
+						const auto &ei = m_entries[i], &ej = m_entries[j];
+						if (ei.cell != ej.cell || ei.index == ej.index) continue;
+						if (ei.cell != cell_max(m_min_cell[ei.index], m_min_cell[ej.index])) continue;
+						if (!overlaps(m_bounds[ei.index], m_bounds[ej.index])) continue;
+						f(std::min(ei.index, ej.index), std::max(ei.index, ej.index));
+					}
+			}
+		}
+		/** Returns indices of every pair of overlapping volumes. Equivalent to collecting results of `find_pairs`. */
+		[[nodiscard]] std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs() const
+		{
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> result;
+			find_pairs([&](std::uint32_t a, std::uint32_t b) { result.emplace_back(a, b); });
+			return result;
+		}
+
+		/** Invokes \a f with the index of every volume overlapping region \a r. Every volume is reported exactly once. */
+		template<typename F>
+		void query_region(const bounds_type &r, F &&f) const
+		{
+			if (m_entries.empty()) [[unlikely]] return;
+
+			const auto rmin = cell_of(r.min()), rmax = cell_of(r.max());
+			for_each_cell(rmin, rmax, [&](const cell_type &cell)
+			{
+				const auto b = bucket_of(cell);
+				for (auto i = m_offsets[b]; i < m_offsets[b + 1]; ++i)
+				{
+					const auto &e = m_entries[i];
+					if (e.cell != cell || e.cell != cell_max(m_min_cell[e.index], rmin)) continue;
+					if (overlaps(m_bounds[e.index], r)) f(e.index);
+				}
+			});
+		}
+		/** Invokes \a f with the index of every volume containing point \a p. */
+		template<typename F>
+		void query_point(const vector_type &p, F &&f) const
+		{
+			if (m_entries.empty()) [[unlikely]] return;
+
+			const auto cell = cell_of(p);
+			const auto b = bucket_of(cell);
+			for (auto i = m_offsets[b]; i < m_offsets[b + 1]; ++i)
+			{
+				const auto &e = m_entries[i];
+				if (e.cell != cell) continue;
+				if (const auto &v = m_bounds[e.index]; all_of(v.min() <= p) && all_of(v.max() >= p)) f(e.index);
+			}
+		}
+
+	private:
+		T m_cell;
+		T m_inv_cell;
+
+		std::vector<bounds_type> m_bounds;
+		std::vector<cell_type> m_min_cell;
+		std::vector<cell_type> m_max_cell;
+		std::vector<std::uint32_t> m_offsets;
+		std::vector<entry> m_entries;
+	};
+
+#pragma region "basic_spatial_grid aliases"
+	/** Alias for N-dimensional spatial hash grid that uses implementation-defined ABI deduced from it's type, size and optional ABI hint. */
+	template<typename T, std::size_t N, typename Abi = math_abi::fixed_size<N>>
+	using spatial_grid = basic_spatial_grid<T, N, math_abi::deduce_t<T, N, Abi>>;
+	/** Alias for 2D spatial hash grid that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<2>>
+	using spatial_grid2 = spatial_grid<T, 2, Abi>;
+	/** Alias for 3D spatial hash grid that uses implementation-defined ABI deduced from it's type and optional ABI hint. */
+	template<typename T, typename Abi = math_abi::fixed_size<3>>
+	using spatial_grid3 = spatial_grid<T, 3, Abi>;
+#pragma endregion
+}
@@ -15,4 +15,5 @@
 #include "detail/neari.hpp"
 #include "detail/fmanip.hpp"
 #include "detail/fclass.hpp"
-#include "detail/geom.hpp"
\ No newline at end of file
+#include "detail/geom.hpp"
+#include "detail/soa_vec.hpp"
\ No newline at end of file
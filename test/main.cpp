@@ -4,6 +4,8 @@
 
 #include <math/math.hpp>
 
+#include <thread>
+
 #define TEST_ASSERT(cnd) DPM_ASSERT_ALWAYS(cnd)
 
 inline void test_translate() noexcept
@@ -85,6 +87,1211 @@ inline void test_scale() noexcept
 	invoke_test({0, 0, 0}, {2, 2, 2}, {0, 0, 0});
 }
 
+inline void test_soa() noexcept
+{
+	constexpr std::size_t n = 37;
+
+	std::vector<sek::vec3<float>> a, b;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const auto f = static_cast<float>(i);
+		a.emplace_back(f, 1.0f - f, 0.5f * f);
+		b.emplace_back(2.0f - f, f * 0.25f, 1.0f);
+	}
+	a[3] = sek::vec3<float>{0};
+
+	const sek::soa_array3<float> sa{a}, sb{b};
+	TEST_ASSERT(sa.size() == n && sa.capacity() % sa.lane_width == 0);
+
+	std::vector<float> dp(n), mg(n);
+	sek::dot(sa, sb, std::span{dp});
+	sek::magn(sa, std::span{mg});
+
+	const auto sc = sek::cross(sa, sb);
+	const auto sn = sek::normalize(sa);
+	const auto sr = sek::reflect(sa, sn);
+	const auto sf = sek::faceforward(sb, sa, sb);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		TEST_ASSERT(sek::fcmp_eq(dp[i], sek::dot(a[i], b[i]), 0.001f));
+		TEST_ASSERT(sek::fcmp_eq(mg[i], sek::magn(a[i]), 0.001f));
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(sc[i], sek::cross(a[i], b[i]), 0.001f)));
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(sf[i], sek::faceforward(b[i], a[i], b[i]), 0.001f)));
+		if (i != 3)
+		{
+			TEST_ASSERT(sek::all_of(sek::fcmp_eq(sn[i], sek::normalize(a[i]), 0.001f)));
+			TEST_ASSERT(sek::all_of(sek::fcmp_eq(sr[i], sek::reflect(a[i], sek::normalize(a[i])), 0.001f)));
+		}
+	}
+	TEST_ASSERT(sek::all_of(sn[3] == sek::vec3<float>{0}));
+}
+
+inline void test_transform_batch() noexcept
+{
+	constexpr std::size_t n = 21;
+
+	const auto m = sek::scale(sek::rotate(sek::translate(sek::mat4x4<float>::identity(), {1, 2, 3}), sek::rad(30.0f), sek::vec3<float>::up()), {2, 1, 0.5f});
+	auto p = m;
+	p[0][3] = 0.25f;
+	p[2][3] = 0.5f;
+	p[3][3] = 2.0f;
+
+	std::vector<sek::vec3<float>> v3(n), r3(n);
+	std::vector<sek::vec4<float>> v4(n), r4(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const auto f = static_cast<float>(i);
+		v3[i] = {f, -f * 0.5f, 1.0f + f};
+		v4[i] = {v3[i], 0.5f * f};
+	}
+
+	sek::transform_points(m, std::span<const sek::vec3<float>>{v3}, std::span{r3});
+	for (std::size_t i = 0; i < n; ++i)
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r3[i], (m * sek::vec4<float>{v3[i], 1}).xyz(), 0.001f)));
+	sek::transform_directions(m, std::span<const sek::vec3<float>>{v3}, std::span{r3});
+	for (std::size_t i = 0; i < n; ++i)
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r3[i], (m * sek::vec4<float>{v3[i], 0}).xyz(), 0.001f)));
+	sek::transform_projective(p, std::span<const sek::vec3<float>>{v3}, std::span{r3});
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const auto r = p * sek::vec4<float>{v3[i], 1};
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r3[i], r.xyz() / r.w(), 0.001f)));
+	}
+
+	sek::transform_points(m, std::span<const sek::vec4<float>>{v4}, std::span{r4});
+	for (std::size_t i = 0; i < n; ++i)
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r4[i], m * v4[i], 0.001f)));
+	sek::transform_directions(m, std::span<const sek::vec4<float>>{v4}, std::span{r4});
+	for (std::size_t i = 0; i < n; ++i)
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r4[i], m * sek::vec4<float>{v4[i].xyz(), 0}, 0.001f)));
+
+	const auto m3 = sek::rotate(sek::mat3x3<float>::identity(), sek::rad(45.0f), sek::vec3<float>::forward());
+	sek::transform_directions(m3, std::span<const sek::vec3<float>>{v3}, std::span{r3});
+	for (std::size_t i = 0; i < n; ++i)
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(r3[i], m3 * v3[i], 0.001f)));
+}
+
+inline void test_multiply_batch() noexcept
+{
+	constexpr std::size_t n = 9;
+
+	std::vector<sek::mat4x4<float>> a(n), b(n), r(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const auto f = static_cast<float>(i);
+		a[i] = sek::rotate(sek::translate(sek::mat4x4<float>::identity(), {f, 1, -f}), sek::rad(10.0f * f), sek::vec3<float>::up());
+		b[i] = sek::scale(sek::rotate(sek::mat4x4<float>::identity(), sek::rad(-5.0f * f), sek::vec3<float>::left()), {1, f + 1, 2});
+	}
+
+	const auto verify = [&](auto &&expected)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			for (std::size_t j = 0; j < 4; ++j) TEST_ASSERT(sek::all_of(sek::fcmp_eq(r[i][j], expected(i)[j], 0.001f)));
+	};
+
+	sek::multiply_batch(std::span<const sek::mat4x4<float>>{a}, std::span<const sek::mat4x4<float>>{b}, std::span{r});
+	verify([&](std::size_t i) { return a[i] * b[i]; });
+	sek::multiply_batch(a[2], std::span<const sek::mat4x4<float>>{b}, std::span{r});
+	verify([&](std::size_t i) { return a[2] * b[i]; });
+	sek::multiply_batch(std::span<const sek::mat4x4<float>>{a}, b[5], std::span{r});
+	verify([&](std::size_t i) { return a[i] * b[5]; });
+}
+
+inline void test_inverse_batch() noexcept
+{
+	constexpr std::size_t n = 19;
+
+	const auto invoke_test = [&]<std::size_t N>(auto &&make)
+	{
+		std::vector<sek::mat<float, N, N>> m(n), r(n);
+		std::vector<float> det(n);
+		bool sing[n];
+
+		for (std::size_t i = 0; i < n; ++i) m[i] = make(static_cast<float>(i));
+		m[7] = sek::mat<float, N, N>{0};
+		m[11] = sek::mat<float, N, N>::identity();
+		for (std::size_t j = 0; j < N; ++j) m[11][j][j] = 0.01f;
+
+		sek::inverse_batch(std::span<const sek::mat<float, N, N>>{m}, std::span{r}, std::span{det}, std::span{sing});
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			TEST_ASSERT(sing[i] == (i == 7));
+			if (i == 7)
+			{
+				TEST_ASSERT((r[i] == sek::mat<float, N, N>{0}));
+				continue;
+			}
+			if (i == 11) TEST_ASSERT(std::abs(r[i][0][0] - 100.0f) <= 0.01f);
+
+			const auto id = m[i] * r[i];
+			for (std::size_t j = 0; j < N; ++j)
+				TEST_ASSERT(sek::all_of(sek::abs(id[j] - sek::mat<float, N, N>::identity()[j]) <= sek::vec<float, N>{0.001f}));
+		}
+	};
+
+	invoke_test.operator()<2>([](float f) { return sek::mat2x2<float>{sek::vec2<float>{f + 1, 0.5f}, sek::vec2<float>{-0.25f * f, 2}}; });
+	invoke_test.operator()<3>([](float f) { return sek::scale(sek::rotate(sek::mat3x3<float>::identity(), sek::rad(7.0f * f), sek::vec3<float>::up()), {f + 1, 2, 0.5f}); });
+	invoke_test.operator()<4>([](float f)
+	{
+		auto m = sek::scale(sek::rotate(sek::mat4x4<float>::identity(), sek::rad(11.0f * f), sek::vec3<float>::forward()), {1, f + 1, 2});
+		m[3] = sek::vec4<float>{f, -1, 2, 1};
+		m[0][3] = 0.1f * f;
+		return m;
+	});
+}
+
+inline void test_affine() noexcept
+{
+	const auto make_mat = [](float f)
+	{
+		auto m = sek::scale(sek::rotate(sek::mat4x4<float>::identity(), sek::rad(13.0f * f), sek::vec3<float>::up()), {1, f + 1, 2});
+		m[3] = sek::vec4<float>{f, -1, 2, 1};
+		return m;
+	};
+	const auto verify = [](const sek::mat4x4<float> &a, const sek::mat4x4<float> &b)
+	{
+		for (std::size_t j = 0; j < 4; ++j) TEST_ASSERT(sek::all_of(sek::abs(a[j] - b[j]) <= sek::vec4<float>{0.001f}));
+	};
+
+	const auto m0 = make_mat(1), m1 = make_mat(2);
+	const auto a0 = sek::affine3<float>{m0}, a1 = sek::affine3<float>{m1};
+	verify(sek::mat4x4<float>{a0}, m0);
+	verify(sek::mat4x4<float>{a0 * a1}, m0 * m1);
+	verify(sek::mat4x4<float>{a0 * sek::inverse(a0)}, sek::mat4x4<float>::identity());
+
+	const auto r = sek::affine3<float>{sek::quat<float>::angle_axis(sek::rad(30.0f), sek::vec3<float>::left()), {1, 2, 3}};
+	verify(sek::mat4x4<float>{r * sek::inverse_rigid(r)}, sek::mat4x4<float>::identity());
+
+	const auto v = sek::vec3<float>{1, -2, 3};
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(sek::transform_point(a0, v), (m0 * sek::vec4<float>{v, 1}).xyz(), 0.001f)));
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(sek::transform_direction(a0, v), (m0 * sek::vec4<float>{v, 0}).xyz(), 0.001f)));
+
+	std::vector<sek::vec3<float>> pts(11, v);
+	sek::transform_points(a0, std::span<const sek::vec3<float>>{pts}, std::span{pts});
+	for (auto &p : pts) TEST_ASSERT(sek::all_of(sek::fcmp_eq(p, sek::transform_point(a0, v), 0.001f)));
+
+	static_assert(sizeof(sek::packed_affine3<float>) == 12 * sizeof(float));
+	static_assert(sizeof(sek::packed_affine3<double>) == 12 * sizeof(double));
+	const auto p0 = sek::packed_affine3<float>{m0};
+	verify(sek::mat4x4<float>{p0}, m0);
+
+	/* Results use the ABI of the input vector regardless of the storage ABI of the transform. */
+	static_assert(std::same_as<decltype(sek::transform_point(p0, v)), sek::vec3<float>>);
+	static_assert(std::same_as<decltype(sek::transform_direction(p0, v)), sek::vec3<float>>);
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(sek::transform_point(p0, v), sek::transform_point(a0, v), 0.001f)));
+}
+
+inline void test_slerp_batch() noexcept
+{
+	constexpr std::size_t n = 23;
+
+	std::vector<sek::quat<float>> a(n), b(n), r(n);
+	std::vector<float> f(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const auto k = static_cast<float>(i);
+		a[i] = sek::quat<float>::angle_axis(sek::rad(3.0f * k), sek::vec3<float>::up());
+		b[i] = sek::quat<float>::angle_axis(sek::rad(170.0f - 7.0f * k), sek::normalize(sek::vec3<float>{1, k, 2}));
+		f[i] = k / static_cast<float>(n - 1);
+	}
+	b[4] = a[4];
+	b[5] = -a[5];
+
+	const auto invoke_test = [&](auto &&batch, auto &&expected, float e)
+	{
+		batch(std::span<const sek::quat<float>>{a}, std::span<const sek::quat<float>>{b}, std::span<const float>{f}, std::span{r});
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const auto x = expected(a[i], b[i], f[i]);
+			TEST_ASSERT(std::abs(std::abs(sek::dot(r[i], x)) - 1.0f) <= e);
+		}
+	};
+	const auto slerp = [](auto a, auto b, float f) { return sek::normalize(sek::slerp(a, b, f)); };
+	const auto nlerp = [](auto a, auto b, float f)
+	{
+		const auto s = sek::dot(a, b) < 0 ? -1.0f : 1.0f;
+		return sek::normalize(sek::quat<float>{a.vector() * (1 - f) + b.vector() * (s * f)});
+	};
+
+	invoke_test([](auto &&...args) { sek::slerp_batch(args...); }, slerp, 0.0001f);
+	invoke_test([](auto &&...args) { sek::fast_slerp_batch(args...); }, slerp, 0.001f);
+	invoke_test([](auto &&...args) { sek::nlerp_batch(args...); }, nlerp, 0.0001f);
+
+	sek::slerp_batch(std::span<const sek::quat<float>>{a}, std::span<const sek::quat<float>>{b}, 0.5f, std::span{r});
+	for (std::size_t i = 0; i < n; ++i) TEST_ASSERT(std::abs(std::abs(sek::dot(r[i], slerp(a[i], b[i], 0.5f))) - 1.0f) <= 0.0001f);
+}
+
+inline void test_dual_quat() noexcept
+{
+	const auto verify = [](const sek::mat4x4<float> &a, const sek::mat4x4<float> &b)
+	{
+		for (std::size_t j = 0; j < 4; ++j) TEST_ASSERT(sek::all_of(sek::abs(a[j] - b[j]) <= sek::vec4<float>{0.001f}));
+	};
+
+	const auto q0 = sek::quat<float>::angle_axis(sek::rad(30.0f), sek::vec3<float>::up());
+	const auto q1 = sek::quat<float>::angle_axis(sek::rad(-75.0f), sek::normalize(sek::vec3<float>{1, 2, 3}));
+	const auto d0 = sek::dual_quat<float>{q0, sek::vec3<float>{1, 2, 3}};
+	const auto d1 = sek::dual_quat<float>{q1, sek::vec3<float>{-4, 0, 0.5f}};
+	const auto m0 = sek::mat4x4<float>{d0}, m1 = sek::mat4x4<float>{d1};
+
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(d0.translation(), sek::vec3<float>{1, 2, 3}, 0.001f)));
+	verify(sek::mat4x4<float>{sek::dual_quat<float>{m0}}, m0);
+	verify(sek::mat4x4<float>{d0 * d1}, m0 * m1);
+	verify(sek::mat4x4<float>{d0 * sek::inverse(d0)}, sek::mat4x4<float>::identity());
+
+	const auto v = sek::vec3<float>{1, -2, 3};
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(sek::transform_point(d0, v), (m0 * sek::vec4<float>{v, 1}).xyz(), 0.001f)));
+
+	const sek::dual_quat<float> bones[] = {d0, d1, -d1, sek::dual_quat<float>::identity()};
+	const float w[] = {0.25f, 0.5f, 0.125f, 0.125f};
+	const auto expected = sek::dlb(std::span<const sek::dual_quat<float>>{bones}, std::span<const float>{w});
+
+	std::vector<sek::vec4<std::uint32_t>> idx(13, sek::vec4<std::uint32_t>{0, 1, 2, 3});
+	std::vector<sek::vec4<float>> wv(13, sek::vec4<float>{w[0], w[1], w[2], w[3]});
+	std::vector<sek::dual_quat<float>> out(13);
+	wv[5] = sek::vec4<float>{0};
+	/* Zero-weight influences are not used as the hemisphere pivot. */
+	idx[6] = sek::vec4<std::uint32_t>{2, 1, 0, 3};
+	wv[6] = sek::vec4<float>{0, 1, 0, 0};
+	const float w6[] = {0, 1};
+	const sek::dual_quat<float> bones6[] = {-d1, d1};
+	const auto expected6 = sek::dlb(std::span<const sek::dual_quat<float>>{bones6}, std::span<const float>{w6});
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(expected6.real().vector(), d1.real().vector(), 0.001f)));
+	sek::dlb_batch(std::span<const sek::dual_quat<float>>{bones}, std::span<const sek::vec4<std::uint32_t>>{idx}, std::span<const sek::vec4<float>>{wv}, std::span{out});
+	for (std::size_t i = 0; i < out.size(); ++i)
+	{
+		/* Vertices without influences blend to identity. */
+		const auto &e = i == 5 ? sek::dual_quat<float>::identity() : i == 6 ? d1 : expected;
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(out[i].real().vector(), e.real().vector(), 0.001f)));
+		TEST_ASSERT(sek::all_of(sek::fcmp_eq(out[i].dual().vector(), e.dual().vector(), 0.001f)));
+	}
+}
+
+inline void test_xoroshiro_simd() noexcept
+{
+	const auto invoke_test = []<typename T, std::size_t W>(sek::xoroshiro<T, W> g)
+	{
+		auto simd_gen = sek::xoroshiro_simd<T, W, 4>{g};
+		sek::xoroshiro<T, W> lanes[4];
+		for (auto &lane : lanes)
+		{
+			lane = g;
+			g.jump();
+		}
+
+		for (std::size_t i = 0; i < 64; ++i)
+		{
+			const auto v = simd_gen();
+			for (std::size_t j = 0; j < 4; ++j) TEST_ASSERT(v[j] == lanes[j]());
+		}
+
+		simd_gen.jump();
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			lanes[j].jump();
+			TEST_ASSERT(simd_gen.lane(j) == lanes[j]);
+		}
+	};
+
+	invoke_test(sek::xoroshiro<std::uint64_t, 256>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint64_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<double, 256>{0x1234});
+	invoke_test(sek::xoroshiro<double, 128>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint32_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<float, 128>{0x1234});
+}
+
+inline void test_xoroshiro_discard() noexcept
+{
+	const auto invoke_test = []<typename T, std::size_t W>(sek::xoroshiro<T, W> g)
+	{
+		for (const std::size_t n : {std::size_t{3}, std::size_t{W + 1}, std::size_t{1000}, std::size_t{123457}})
+		{
+			auto a = g, b = g;
+			a.discard(n);
+			for (std::size_t i = 0; i < n; ++i) b();
+			TEST_ASSERT(a == b);
+		}
+
+		/* 128-bit distances reach the jump distance, which is 2^128 for 256-bit generators and 2^64 otherwise. */
+		auto a = g, b = g;
+		if constexpr (W == 256)
+		{
+			a.discard(~std::uint64_t{0}, ~std::uint64_t{0});
+			a.discard(1);
+		}
+		else
+			a.discard(1, 0);
+		b.jump();
+		TEST_ASSERT(a == b);
+
+		auto simd_gen = sek::xoroshiro_simd<T, W, 4>{g};
+		simd_gen.discard(1000);
+		for (std::size_t j = 0; j < 4; ++j, g.jump())
+		{
+			auto lane = g;
+			lane.discard(1000);
+			TEST_ASSERT(simd_gen.lane(j) == lane);
+		}
+	};
+
+	invoke_test(sek::xoroshiro<std::uint64_t, 256>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint64_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<double, 256>{0x1234});
+	invoke_test(sek::xoroshiro<double, 128>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint32_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<float, 128>{0x1234});
+}
+
+inline void test_xoroshiro_generate() noexcept
+{
+	const auto invoke_test = []<typename T, std::size_t W>(sek::xoroshiro<T, W> g)
+	{
+		auto ref = g;
+		std::vector<T> out(37);
+		g.generate(std::span{out});
+		for (auto v : out) TEST_ASSERT(v == ref());
+		TEST_ASSERT(g == ref);
+	};
+
+	invoke_test(sek::xoroshiro<std::uint64_t, 256>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint64_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<double, 256>{0x1234});
+	invoke_test(sek::xoroshiro<double, 128>{0x1234});
+	invoke_test(sek::xoroshiro<std::uint32_t, 128>{0x1234});
+	invoke_test(sek::xoroshiro<float, 128>{0x1234});
+
+	{
+		auto g = sek::xoroshiro<float, 128>{0x1234};
+		auto ref = g;
+		std::vector<float> out(29);
+		g.generate_uniform(std::span{out}, -2.0f, 3.0f);
+		for (auto v : out)
+		{
+			TEST_ASSERT(v >= -2.0f && v < 3.0f);
+			TEST_ASSERT(std::abs(v - (ref() * 5.0f - 2.0f)) <= 0.0001f);
+		}
+	}
+	{
+		auto g = sek::xoroshiro<std::uint32_t, 128>{0x1234};
+		auto ref = g;
+		std::byte out[23];
+		g.generate_bits(std::span{out});
+		for (std::size_t i = 0; i < sizeof(out); i += sizeof(std::uint32_t))
+		{
+			const auto word = ref();
+			TEST_ASSERT(std::memcmp(out + i, &word, std::min(sizeof(word), sizeof(out) - i)) == 0);
+		}
+		TEST_ASSERT(g == ref);
+	}
+}
+
+inline void test_sampling() noexcept
+{
+	auto g = sek::xoroshiro<float, 128>{0x1234};
+	auto g64 = sek::xoroshiro<std::uint64_t, 256>{0x1234};
+
+	const auto b = sek::bbox<float>{{-1, 2, 0}, {1, 3, 5}};
+	std::vector<sek::vec3<float>> p(37);
+	sek::random_in_bounds(g, b, std::span{p});
+	p.push_back(sek::random_in_bounds(g64, b));
+	for (auto &v : p) TEST_ASSERT(sek::all_of(v >= b.min() && v < b.max()));
+
+	const auto unit = [](const auto &v) { return std::abs(sek::magn(v) - 1.0f) <= 0.001f; };
+	std::vector<sek::vec3<float>> d(37);
+	sek::random_on_sphere(g, std::span{d});
+	d.push_back(sek::random_on_sphere<float>(g64));
+	for (auto &v : d) TEST_ASSERT(unit(v));
+
+	sek::random_on_hemisphere(g, std::span{d});
+	d.back() = sek::random_on_hemisphere<float>(g64);
+	for (auto &v : d) TEST_ASSERT(unit(v) && v.z() >= 0.0f);
+
+	sek::random_cosine_hemisphere(g, std::span{d});
+	d.back() = sek::random_cosine_hemisphere<float>(g64);
+	for (auto &v : d) TEST_ASSERT(unit(v) && v.z() >= 0.0f);
+
+	std::vector<sek::vec2<float>> c(37);
+	sek::random_in_disc(g, std::span{c});
+	c.push_back(sek::random_in_disc<float>(g64));
+	for (auto &v : c) TEST_ASSERT(sek::magn(v) <= 1.0f);
+
+	std::vector<sek::quat<float>> q(37);
+	sek::random_quat(g, std::span{q});
+	q.push_back(sek::random_quat<float>(g64));
+	for (auto &v : q) TEST_ASSERT(unit(v.vector()));
+
+	/* Batched samples match consecutive scalar samples. */
+	auto g0 = sek::xoroshiro<float, 128>{0x4321}, g1 = g0;
+	sek::random_on_sphere(g0, std::span{d});
+	for (auto &v : d) TEST_ASSERT(sek::all_of(sek::abs(v - sek::random_on_sphere<float>(g1)) <= sek::vec3<float>{0.001f}));
+}
+
+inline void test_entropy_pool() noexcept
+{
+	std::byte a[64] = {}, b[64] = {};
+	TEST_ASSERT(sek::sys::entropy_pool::fill(a, sizeof(a)) == sizeof(a));
+	TEST_ASSERT(sek::sys::entropy_pool::fill(std::span{b}, sizeof(b)) == sizeof(b));
+	TEST_ASSERT(std::memcmp(a, b, sizeof(a)) != 0);
+
+	std::vector<std::byte> large(sek::sys::entropy_pool::buffer_size + 1);
+	TEST_ASSERT(sek::sys::entropy_pool::fill(large.data(), large.size()) == static_cast<sek::ssize_t>(large.size()));
+
+	auto seq = sek::sys::entropy_seed_seq<std::uint64_t>{};
+	const auto g0 = sek::xoroshiro<std::uint64_t, 256>{seq};
+	const auto g1 = sek::xoroshiro<std::uint64_t, 256>{seq};
+	TEST_ASSERT(g0 != g1);
+
+	auto seq32 = sek::sys::entropy_seed_seq<>{};
+	auto g2 = sek::xoroshiro<float, 128>{seq32};
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		const auto v = g2();
+		TEST_ASSERT(v >= 0.0f && v < 1.0f);
+	}
+}
+
+inline void test_xoroshiro_registry() noexcept
+{
+	{
+		auto a = sek::xoroshiro<std::uint64_t, 256>{0x1234}, b = a;
+		a.jump(5);
+		for (std::size_t i = 0; i < 5; ++i) b.jump();
+		TEST_ASSERT(a == b);
+
+		auto c = sek::xoroshiro<float, 128>{0x1234}, d = c;
+		c.long_jump(3);
+		for (std::size_t i = 0; i < 3; ++i) d.long_jump();
+		TEST_ASSERT(c == d);
+	}
+
+	auto registry = sek::xoroshiro_registry<double>{0x1234};
+	auto root = registry.root();
+	for (std::size_t i = 0; i < 4; ++i, root.jump()) TEST_ASSERT(registry.stream(i) == root);
+
+	auto &l0 = registry.local(2);
+	TEST_ASSERT(&l0 == &registry.local());
+	TEST_ASSERT(l0 == registry.stream(2));
+
+	sek::xoroshiro<double, 256> other[2];
+	std::thread t0([&]() { other[0] = registry.local(); });
+	t0.join();
+	std::thread t1([&]() { other[1] = registry.local(); });
+	t1.join();
+	TEST_ASSERT(other[0] == registry.stream(0) && other[1] == registry.stream(1));
+
+	const auto partitioned = sek::xoroshiro_registry<double>{0x1234, 1};
+	auto expected = sek::xoroshiro<double, 256>{0x1234};
+	expected.long_jump();
+	TEST_ASSERT(partitioned.root() == expected);
+
+	/* Interleaved registries on the same thread keep separate engines. */
+	auto reg_a = sek::xoroshiro_registry<double>{0x1234};
+	auto reg_b = sek::xoroshiro_registry<double>{0x5678};
+	auto &la = reg_a.local(3);
+	static_cast<void>(la());
+	auto la_state = la;
+	auto &lb = reg_b.local(1);
+	TEST_ASSERT(&la != &lb);
+	TEST_ASSERT(lb == reg_b.stream(1));
+	TEST_ASSERT(&reg_a.local(0) == &la);
+	TEST_ASSERT(la == la_state);
+	TEST_ASSERT(&reg_b.local() == &lb);
+}
+
+inline void test_philox() noexcept
+{
+	using ctr_t = sek::philox4x32::counter_type;
+	using key_t = sek::philox4x32::key_type;
+
+	/* Known-answer vectors of the reference implementation. */
+	const auto kat = [](key_t k, ctr_t c, ctr_t expected) { TEST_ASSERT(sek::all_of(sek::philox4x32::generate(k, c) == expected)); };
+	kat({0, 0}, {0, 0, 0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+	kat({0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+	kat({0xa4093822, 0x299f31d0}, {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+	const auto key = key_t{0x1234, 0x5678};
+	const auto base = ctr_t{0xfffffffe, 0, 7, 9};
+	const auto counter = [&](std::size_t i) { return ctr_t{static_cast<std::uint32_t>(0xfffffffe + i), i >= 2 ? 1 : 0, 7, 9}; };
+
+	std::vector<std::uint32_t> words(4 * 21 + 3);
+	sek::philox4x32::generate(key, base, std::span{words});
+	for (std::size_t i = 0; i < words.size(); ++i) TEST_ASSERT(words[i] == sek::philox4x32::generate(key, counter(i / 4))[i % 4]);
+
+	std::vector<float> floats(4 * 21 + 1);
+	sek::philox4x32::generate(key, base, std::span{floats});
+	for (std::size_t i = 0; i < floats.size(); ++i) TEST_ASSERT(floats[i] == sek::philox4x32::generate_float(key, counter(i / 4))[i % 4]);
+
+	std::vector<double> doubles(2 * 21 + 1);
+	sek::philox4x32::generate(key, base, std::span{doubles});
+	for (std::size_t i = 0; i < doubles.size(); ++i)
+	{
+		TEST_ASSERT(doubles[i] >= 0.0 && doubles[i] < 1.0);
+		TEST_ASSERT(doubles[i] == sek::philox4x32::generate_double(key, counter(i / 2))[i % 2]);
+	}
+}
+
+inline void test_serialize() noexcept
+{
+	static_assert(sek::serialized_size_v<sek::vec3<float>> == 12);
+	static_assert(sek::serialized_size_v<sek::mat4x3<double>> == 96);
+	static_assert(sek::serialized_size_v<sek::xoroshiro<float, 128>> == 16);
+
+	std::byte buff[512];
+	{
+		const auto v = sek::vec3<float>{1, 2, 3};
+		TEST_ASSERT(sek::serialize(v, std::span{buff}) == 12);
+		TEST_ASSERT(sek::serialize(v, std::span{buff, 11}) == 0);
+
+		float f[3];
+		std::memcpy(f, buff, sizeof(f));
+		TEST_ASSERT(f[0] == 1 && f[1] == 2 && f[2] == 3);
+
+		sek::vec3<float> r;
+		TEST_ASSERT(sek::deserialize(r, std::span<const std::byte>{buff}) == 12);
+		TEST_ASSERT(sek::all_of(r == v));
+	}
+	{
+		const auto m = sek::mat4x4<float>{sek::quat<float>::angle_axis(sek::rad(30.0f), sek::vec3<float>::up())};
+		const auto q = sek::quat<float>{1, 2, 3, 4};
+		const auto b = sek::bbox<float>{{-1, -2, -3}, {1, 2, 3}};
+
+		std::size_t n = sek::serialize(m, std::span{buff});
+		n += sek::serialize(q, std::span{buff}.subspan(n));
+		n += sek::serialize(b, std::span{buff}.subspan(n));
+		TEST_ASSERT(n == 64 + 16 + 24);
+
+		sek::mat4x4<float> rm;
+		sek::quat<float> rq;
+		sek::bbox<float> rb;
+		const auto src = std::span<const std::byte>{buff};
+		n = sek::deserialize(rm, src);
+		n += sek::deserialize(rq, src.subspan(n));
+		n += sek::deserialize(rb, src.subspan(n));
+		TEST_ASSERT(n == 64 + 16 + 24);
+		TEST_ASSERT(rm == m && rq == q);
+		TEST_ASSERT(sek::all_of(rb.min() == b.min()) && sek::all_of(rb.max() == b.max()));
+	}
+	{
+		std::vector<sek::vec3<float>> v(37), r(37);
+		for (std::size_t i = 0; i < v.size(); ++i) v[i] = sek::vec3<float>{static_cast<float>(i), 1, 2};
+		std::vector<std::byte> data(v.size() * sek::serialized_size_v<sek::vec3<float>>);
+		TEST_ASSERT(sek::serialize(std::span<const sek::vec3<float>>{v}, std::span{data}) == data.size());
+		TEST_ASSERT(sek::deserialize(std::span{r}, std::span<const std::byte>{data}) == data.size());
+		for (std::size_t i = 0; i < v.size(); ++i) TEST_ASSERT(sek::all_of(r[i] == v[i]));
+	}
+	{
+		auto g = sek::xoroshiro<std::uint64_t, 256>{0x1234};
+		auto simd_gen = sek::xoroshiro_simd<float, 128, 4>{0x1234};
+		TEST_ASSERT(sek::serialize(g, std::span{buff}) == 32);
+		TEST_ASSERT(sek::serialize(simd_gen, std::span{buff}.subspan(32)) == 64);
+
+		sek::xoroshiro<std::uint64_t, 256> rg;
+		sek::xoroshiro_simd<float, 128, 4> rs;
+		TEST_ASSERT(sek::deserialize(rg, std::span<const std::byte>{buff}) == 32);
+		TEST_ASSERT(sek::deserialize(rs, std::span<const std::byte>{buff}.subspan(32)) == 64);
+		TEST_ASSERT(rg == g && rs == simd_gen);
+		TEST_ASSERT(rg() == g());
+	}
+}
+
+inline void test_bvh() noexcept
+{
+	auto g = sek::xoroshiro<float, 128>{0x5eed};
+	const auto random_box = [&](float extent)
+	{
+		const auto c = sek::vec3<float>{g(), g(), g()} * 100.0f;
+		const auto s = sek::vec3<float>{g(), g(), g()} * extent;
+		return sek::bbox<float>{c - s, c + s};
+	};
+	const auto overlaps = [](const sek::bbox<float> &a, const sek::bbox<float> &b)
+	{
+		return sek::all_of(a.min() <= b.max()) && sek::all_of(a.max() >= b.min());
+	};
+
+	/* Large enough to build subtrees in parallel. */
+	std::vector<sek::bbox<float>> boxes(10000);
+	for (auto &b: boxes) b = random_box(2.0f);
+	const auto bvh = sek::bvh<float>{boxes};
+	TEST_ASSERT(bvh.size() == boxes.size());
+
+	for (std::size_t i = 0; i < 32; ++i)
+	{
+		const auto q = random_box(10.0f);
+		std::vector<std::uint32_t> expected, result;
+		for (std::uint32_t j = 0; j < boxes.size(); ++j)
+			if (overlaps(boxes[j], q)) expected.push_back(j);
+		bvh.query_overlap(q, [&](std::uint32_t j) { result.push_back(j); });
+		std::ranges::sort(result);
+		TEST_ASSERT(result == expected);
+
+		const auto p = q.center();
+		expected.clear();
+		result.clear();
+		for (std::uint32_t j = 0; j < boxes.size(); ++j)
+			if (sek::all_of(boxes[j].min() <= p) && sek::all_of(boxes[j].max() >= p)) expected.push_back(j);
+		bvh.query_point(p, [&](std::uint32_t j) { result.push_back(j); });
+		std::ranges::sort(result);
+		TEST_ASSERT(result == expected);
+	}
+	for (std::size_t i = 0; i < 32; ++i)
+	{
+		const auto origin = sek::vec3<float>{-10.0f, g() * 100.0f, g() * 100.0f};
+		const auto dir = sek::normalize(sek::vec3<float>{1.0f, g() - 0.5f, g() - 0.5f});
+
+		auto best = std::numeric_limits<float>::infinity();
+		for (const auto &b: boxes)
+		{
+			const auto t0 = (b.min() - origin) / dir, t1 = (b.max() - origin) / dir;
+			const auto tn = std::max(sek::hmax(sek::min(t0, t1)), 0.0f), tf = sek::hmin(sek::max(t0, t1));
+			if (tn <= tf) best = std::min(best, tn);
+		}
+
+		const auto hit = bvh.nearest_hit(origin, dir);
+		TEST_ASSERT(hit.has_value() == (best != std::numeric_limits<float>::infinity()));
+		if (hit.has_value()) TEST_ASSERT(std::abs(hit->distance - best) <= 1e-3f);
+	}
+
+	/* User indices & refit. */
+	const std::vector<std::uint32_t> indices = {10, 20, 30};
+	const std::vector<sek::bbox<float>> small = {{{0, 0, 0}, {1, 1, 1}}, {{2, 0, 0}, {3, 1, 1}}, {{4, 0, 0}, {5, 1, 1}}};
+	auto small_bvh = sek::bvh<float>{small, indices};
+	std::vector<std::uint32_t> result;
+	small_bvh.query_point({2.5f, 0.5f, 0.5f}, [&](std::uint32_t j) { result.push_back(j); });
+	TEST_ASSERT(result == std::vector<std::uint32_t>{20});
+
+	const std::vector<sek::bbox<float>> moved = {{{0, 0, 0}, {1, 1, 1}}, {{2, 5, 0}, {3, 6, 1}}, {{4, 0, 0}, {5, 1, 1}}};
+	small_bvh.refit(moved);
+	result.clear();
+	small_bvh.query_point({2.5f, 0.5f, 0.5f}, [&](std::uint32_t j) { result.push_back(j); });
+	TEST_ASSERT(result.empty());
+	TEST_ASSERT(sek::all_of(small_bvh.bounds().max() == sek::vec3<float>{5, 6, 1}));
+}
+
+inline void test_frustum() noexcept
+{
+	const auto n = 1.0f, f = 100.0f, t = std::tan(sek::rad(45.0f));
+	auto rh = sek::mat4x4<float>{0}, lh = sek::mat4x4<float>{0};
+	rh[0][0] = lh[0][0] = rh[1][1] = lh[1][1] = 1.0f / t;
+	/* Right-handed projection with [-1, 1] depth looking down -Z, left-handed projection with [0, 1] depth looking down +Z. */
+	rh[2][2] = (f + n) / (n - f);
+	rh[2][3] = -1.0f;
+	rh[3][2] = 2.0f * f * n / (n - f);
+	lh[2][2] = f / (f - n);
+	lh[2][3] = 1.0f;
+	lh[3][2] = -n * f / (f - n);
+
+	const auto frh = sek::frustum<float>{rh};
+	const auto flh = sek::frustum<float>{lh, sek::clip_zero_to_one};
+	TEST_ASSERT(frh.contains(sek::vec3<float>{0, 0, -5}) && !frh.contains(sek::vec3<float>{0, 0, 5}));
+	TEST_ASSERT(flh.contains(sek::vec3<float>{0, 0, 5}) && !flh.contains(sek::vec3<float>{0, 0, -5}));
+	TEST_ASSERT(!frh.contains(sek::vec3<float>{0, 0, -0.5f}) && !frh.contains(sek::vec3<float>{0, 0, -101}));
+	TEST_ASSERT(!flh.contains(sek::vec3<float>{0, 0, 0.5f}) && !flh.contains(sek::vec3<float>{0, 0, 101}));
+	TEST_ASSERT(std::abs(frh.plane(sek::frustum<float>::plane_near).w() + 1.0f) <= 1e-4f);
+	TEST_ASSERT(frh.intersects(sek::vec3<float>{0, 0, 1}, 2.0f) && !frh.intersects(sek::vec3<float>{0, 0, 5}, 2.0f));
+
+	auto g = sek::xoroshiro<float, 128>{0xf00};
+	std::vector<sek::bbox<float>> boxes(1003);
+	std::vector<sek::vec3<float>> centers(boxes.size());
+	std::vector<float> radii(boxes.size());
+	for (std::size_t i = 0; i < boxes.size(); ++i)
+	{
+		const auto c = (sek::vec3<float>{g(), g(), g()} - 0.5f) * 200.0f;
+		const auto e = sek::vec3<float>{g(), g(), g()} * 5.0f;
+		boxes[i] = sek::bbox<float>{c - e, c + e};
+		centers[i] = c;
+		radii[i] = e.x();
+	}
+
+	for (const auto &fr: {frh, flh})
+	{
+		std::vector<std::uint8_t> visible(boxes.size());
+		std::vector<std::uint64_t> bits((boxes.size() + 63) / 64);
+		fr.cull(std::span<const sek::bbox<float>>{boxes}, std::span{visible});
+		fr.cull(std::span<const sek::bbox<float>>{boxes}, std::span{bits});
+		std::size_t n_visible = 0;
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			TEST_ASSERT(visible[i] == fr.intersects(boxes[i]));
+			TEST_ASSERT(((bits[i / 64] >> (i % 64)) & 1) == visible[i]);
+			n_visible += visible[i];
+		}
+		TEST_ASSERT(n_visible != 0 && n_visible != boxes.size());
+
+		fr.cull(std::span<const sek::vec3<float>>{centers}, std::span<const float>{radii}, std::span{visible});
+		fr.cull(std::span<const sek::vec3<float>>{centers}, std::span<const float>{radii}, std::span{bits});
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			TEST_ASSERT(visible[i] == fr.intersects(centers[i], radii[i]));
+			TEST_ASSERT(((bits[i / 64] >> (i % 64)) & 1) == visible[i]);
+		}
+	}
+}
+
+inline void test_ray() noexcept
+{
+	const auto box = sek::bbox<float>{{-1, -1, -1}, {1, 1, 1}};
+	{
+		const auto r = sek::ray3<float>{{-5, 0, 0}, {1, 0, 0}};
+		TEST_ASSERT(r.sign() == 0 && sek::all_of(r.at(2.0f) == sek::vec3<float>{-3, 0, 0}));
+
+		const auto i = sek::intersect(r, box);
+		TEST_ASSERT(i.hit() && i.tnear == 4.0f && i.tfar == 6.0f);
+		TEST_ASSERT(!sek::intersect(r, box, 0.0f, 3.0f).hit());
+		TEST_ASSERT(!sek::intersect(sek::ray3<float>{{-5, 2, 0}, {1, 0, 0}}, box).hit());
+		TEST_ASSERT(!sek::intersect(sek::ray3<float>{{-5, 0, 0}, {-1, 0, 0}}, box).hit());
+		TEST_ASSERT((sek::ray3<float>{{0, 0, 0}, {-1, 1, -1}}.sign() == 0b101));
+	}
+
+	auto g = sek::xoroshiro<float, 128>{0xa11};
+	const auto random_vec = [&](float s) { return (sek::vec3<float>{g(), g(), g()} - 0.5f) * s; };
+
+	std::vector<sek::bbox<float>> boxes(517);
+	sek::soa_array3<float> bmin, bmax;
+	for (auto &b: boxes)
+	{
+		const auto c = random_vec(40.0f), e = sek::abs(random_vec(4.0f));
+		b = sek::bbox<float>{c - e, c + e};
+		bmin.push_back(b.min());
+		bmax.push_back(b.max());
+	}
+
+	std::vector<float> tnear(boxes.size()), tfar(boxes.size()), tnear_soa(boxes.size());
+	std::vector<std::uint64_t> hits((boxes.size() + 63) / 64), hits_soa(hits.size());
+	for (std::size_t k = 0; k < 8; ++k)
+	{
+		const auto r = sek::ray3<float>{random_vec(60.0f), random_vec(2.0f)};
+		sek::intersect(r, std::span<const sek::bbox<float>>{boxes}, std::span{tnear}, std::span{tfar}, std::span{hits}, 0.0f, 100.0f);
+		sek::intersect(r, bmin, bmax, std::span{tnear_soa}, std::span<float>{}, std::span{hits_soa}, 0.0f, 100.0f);
+		TEST_ASSERT(hits == hits_soa);
+
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			const auto expected = sek::intersect(r, boxes[i], 0.0f, 100.0f);
+			TEST_ASSERT(((hits[i / 64] >> (i % 64)) & 1) == expected.hit());
+			if (expected.hit())
+			{
+				TEST_ASSERT(std::abs(tnear[i] - expected.tnear) <= 1e-4f && std::abs(tfar[i] - expected.tfar) <= 1e-4f);
+				TEST_ASSERT(std::abs(tnear_soa[i] - expected.tnear) <= 1e-4f);
+			}
+		}
+	}
+
+	std::vector<sek::ray3<float>> rays(301);
+	for (auto &r: rays) r = sek::ray3<float>{random_vec(20.0f), random_vec(2.0f)};
+	hits.assign((rays.size() + 63) / 64, 0);
+	tnear.resize(rays.size());
+	tfar.resize(rays.size());
+	sek::intersect(std::span<const sek::ray3<float>>{rays}, box, std::span{tnear}, std::span{tfar}, std::span{hits});
+
+	std::size_t n_hits = 0;
+	for (std::size_t i = 0; i < rays.size(); ++i)
+	{
+		const auto expected = sek::intersect(rays[i], box);
+		TEST_ASSERT(((hits[i / 64] >> (i % 64)) & 1) == expected.hit());
+		if (expected.hit()) TEST_ASSERT(std::abs(tnear[i] - expected.tnear) <= 1e-4f && std::abs(tfar[i] - expected.tfar) <= 1e-4f);
+		n_hits += expected.hit();
+	}
+	TEST_ASSERT(n_hits != 0 && n_hits != rays.size());
+}
+
+inline void test_transform_bounds() noexcept
+{
+	const auto corners_bounds = [](const auto &m, const sek::bbox<float> &b)
+	{
+		auto min = sek::vec3<float>{std::numeric_limits<float>::max()}, max = sek::vec3<float>{std::numeric_limits<float>::lowest()};
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			const auto p = sek::vec3<float>{(i & 1 ? b.max() : b.min()).x(), (i & 2 ? b.max() : b.min()).y(), (i & 4 ? b.max() : b.min()).z()};
+			sek::vec3<float> tp;
+			if constexpr (requires { m * sek::vec4<float>{p, 1}; })
+				tp = (m * sek::vec4<float>{p, 1}).xyz();
+			else
+				tp = m * p;
+			min = sek::min(min, tp);
+			max = sek::max(max, tp);
+		}
+		return sek::bbox<float>{min, max};
+	};
+	const auto near_eq = [](const sek::bbox<float> &a, const sek::bbox<float> &b)
+	{
+		return sek::all_of(sek::abs(a.min() - b.min()) <= sek::vec3<float>{1e-4f}) && sek::all_of(sek::abs(a.max() - b.max()) <= sek::vec3<float>{1e-4f});
+	};
+
+	auto g = sek::xoroshiro<float, 128>{0xb0b};
+	const auto random_vec = [&](float s) { return (sek::vec3<float>{g(), g(), g()} - 0.5f) * s; };
+
+	std::vector<sek::bbox<float>> boxes(133), out(boxes.size());
+	std::vector<sek::mat4x4<float>> m4(boxes.size());
+	std::vector<sek::mat3x3<float>> m3(boxes.size());
+	for (std::size_t i = 0; i < boxes.size(); ++i)
+	{
+		const auto c = random_vec(20.0f), e = sek::abs(random_vec(4.0f));
+		boxes[i] = sek::bbox<float>{c - e, c + e};
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			m3[i][j] = random_vec(2.0f);
+			m4[i][j] = sek::vec4<float>{m3[i][j], 0};
+		}
+		m4[i][3] = sek::vec4<float>{random_vec(10.0f), 1};
+	}
+
+	for (std::size_t i = 0; i < boxes.size(); ++i)
+	{
+		TEST_ASSERT(near_eq(m4[i] * boxes[i], corners_bounds(m4[i], boxes[i])));
+		TEST_ASSERT(near_eq(m3[i] * boxes[i], corners_bounds(m3[i], boxes[i])));
+	}
+
+	const auto in = std::span<const sek::bbox<float>>{boxes};
+	sek::transform_bounds(m4[0], in, std::span{out});
+	for (std::size_t i = 0; i < boxes.size(); ++i) TEST_ASSERT(near_eq(out[i], m4[0] * boxes[i]));
+	sek::transform_bounds(m3[0], in, std::span{out});
+	for (std::size_t i = 0; i < boxes.size(); ++i) TEST_ASSERT(near_eq(out[i], m3[0] * boxes[i]));
+	sek::transform_bounds(std::span<const sek::mat4x4<float>>{m4}, in, std::span{out});
+	for (std::size_t i = 0; i < boxes.size(); ++i) TEST_ASSERT(near_eq(out[i], m4[i] * boxes[i]));
+	sek::transform_bounds(std::span<const sek::mat3x3<float>>{m3}, in, std::span{out});
+	for (std::size_t i = 0; i < boxes.size(); ++i) TEST_ASSERT(near_eq(out[i], m3[i] * boxes[i]));
+}
+
+inline void test_spatial_grid() noexcept
+{
+	auto g = sek::xoroshiro<float, 128>{0x6e1d};
+	const auto invoke_test = [&]<std::size_t N>(std::integral_constant<std::size_t, N>, std::size_t n, float extent, float cell)
+	{
+		using bounds_t = sek::bounds<float, N>;
+		using vec_t = sek::vec<float, N>;
+		const auto random_vec = [&]()
+		{
+			vec_t result;
+			for (std::size_t i = 0; i < N; ++i) result[i] = g();
+			return result;
+		};
+		const auto overlaps = [](const bounds_t &a, const bounds_t &b) { return sek::all_of(a.min() <= b.max()) && sek::all_of(a.max() >= b.min()); };
+
+		std::vector<bounds_t> boxes(n);
+		for (auto &b: boxes)
+		{
+			const auto c = (random_vec() - 0.5f) * extent, e = random_vec() * 1.5f;
+			b = bounds_t{c - e, c + e};
+		}
+		const auto grid = sek::spatial_grid<float, N>{cell, boxes};
+		TEST_ASSERT(grid.size() == n && grid.entry_count() >= n);
+
+		/* Reference pairs via sort & sweep along X. */
+		std::vector<std::uint32_t> order(n);
+		std::iota(order.begin(), order.end(), 0u);
+		std::ranges::sort(order, [&](auto a, auto b) { return boxes[a].min()[0] < boxes[b].min()[0]; });
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> expected;
+		for (std::size_t i = 0; i < n; ++i)
+			for (std::size_t j = i + 1; j < n && boxes[order[j]].min()[0] <= boxes[order[i]].max()[0]; ++j)
+				if (overlaps(boxes[order[i]], boxes[order[j]]))
+					expected.emplace_back(std::min(order[i], order[j]), std::max(order[i], order[j]));
+
+		auto result = grid.pairs();
+		std::ranges::sort(expected);
+		std::ranges::sort(result);
+		TEST_ASSERT(!expected.empty() && result == expected);
+
+		for (std::size_t k = 0; k < 16; ++k)
+		{
+			const auto c = (random_vec() - 0.5f) * extent, e = random_vec() * 8.0f;
+			const auto r = bounds_t{c - e, c + e};
+			std::vector<std::uint32_t> exp_idx, res_idx;
+			for (std::uint32_t i = 0; i < n; ++i)
+				if (overlaps(boxes[i], r)) exp_idx.push_back(i);
+			grid.query_region(r, [&](std::uint32_t i) { res_idx.push_back(i); });
+			std::ranges::sort(res_idx);
+			TEST_ASSERT(res_idx == exp_idx);
+
+			exp_idx.clear();
+			res_idx.clear();
+			for (std::uint32_t i = 0; i < n; ++i)
+				if (sek::all_of(boxes[i].min() <= c) && sek::all_of(boxes[i].max() >= c)) exp_idx.push_back(i);
+			grid.query_point(c, [&](std::uint32_t i) { res_idx.push_back(i); });
+			std::ranges::sort(res_idx);
+			TEST_ASSERT(res_idx == exp_idx);
+		}
+	};
+
+	invoke_test(std::integral_constant<std::size_t, 2>{}, 2000, 200.0f, 2.0f);
+	invoke_test(std::integral_constant<std::size_t, 3>{}, 2000, 60.0f, 2.5f);
+	/* Large enough to be binned in parallel. */
+	invoke_test(std::integral_constant<std::size_t, 3>{}, 40000, 150.0f, 3.0f);
+}
+
+inline void test_spatial_keys() noexcept
+{
+	static_assert(sek::morton_encode(1u, 0u) == 1 && sek::morton_encode(0u, 1u) == 2 && sek::morton_encode(3u, 3u) == 15);
+	static_assert(sek::morton_encode(1u, 0u, 0u) == 1 && sek::morton_encode(0u, 1u, 0u) == 2 && sek::morton_encode(0u, 0u, 1u) == 4);
+	static_assert(sek::morton_encode(std::uint64_t{0xffff'ffff}, std::uint64_t{0}) == 0x5555'5555'5555'5555);
+	static_assert(sek::morton_encode(std::uint64_t{0x1f'ffff}, std::uint64_t{0}, std::uint64_t{0}) == 0x1249'2492'4924'9249);
+	static_assert(sek::morton_encode(0x3ffu, 0x3ffu, 0x3ffu) == 0x3fff'ffff);
+
+	/* Hilbert keys must be a bijection, where consecutive keys map to adjacent cells. */
+	const auto test_hilbert = [&]<typename K, std::size_t N, std::size_t bits>()
+	{
+		const auto side = std::size_t{1} << bits;
+		std::vector<std::array<K, N>> cells(std::size_t{1} << (bits * N));
+		for (std::size_t i = 0; i < cells.size(); ++i)
+		{
+			std::array<K, N> c;
+			for (std::size_t j = 0; j < N; ++j) c[j] = static_cast<K>((i >> (j * bits)) & (side - 1));
+
+			K key;
+			if constexpr (N == 2)
+				key = sek::hilbert_encode<bits>(c[0], c[1]);
+			else
+				key = sek::hilbert_encode<bits>(c[0], c[1], c[2]);
+			TEST_ASSERT(key < cells.size());
+			cells[key] = c;
+		}
+		for (std::size_t i = 1; i < cells.size(); ++i)
+		{
+			std::size_t dist = 0;
+			for (std::size_t j = 0; j < N; ++j) dist += cells[i][j] > cells[i - 1][j] ? cells[i][j] - cells[i - 1][j] : cells[i - 1][j] - cells[i][j];
+			TEST_ASSERT(dist == 1);
+		}
+	};
+	test_hilbert.operator()<std::uint32_t, 2, 5>();
+	test_hilbert.operator()<std::uint64_t, 2, 4>();
+	test_hilbert.operator()<std::uint32_t, 3, 3>();
+	test_hilbert.operator()<std::uint64_t, 3, 4>();
+
+	auto g = sek::xoroshiro<float, 128>{0x4b1d};
+	const auto test_batch = [&]<typename K, std::size_t N>()
+	{
+		using vec_t = sek::vec<float, N>;
+		const auto bits = sek::spatial_key_bits<K, N>;
+		const auto cells = static_cast<float>(std::uint64_t{1} << bits);
+
+		vec_t bmin, bmax;
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			bmin[j] = -10.0f - static_cast<float>(j);
+			bmax[j] = 20.0f + static_cast<float>(j);
+		}
+		const auto b = sek::bounds<float, N>{bmin, bmax};
+
+		std::vector<vec_t> pos(77);
+		for (auto &p: pos)
+			for (std::size_t j = 0; j < N; ++j) p[j] = g() * 40.0f - 15.0f;
+		pos[0] = bmin;
+		pos[1] = bmax;
+
+		std::vector<K> morton(pos.size()), hilbert(pos.size());
+		sek::morton_keys(std::span<const vec_t>{pos}, b, std::span{morton});
+		sek::hilbert_keys(std::span<const vec_t>{pos}, b, std::span{hilbert});
+		for (std::size_t i = 0; i < pos.size(); ++i)
+		{
+			K q[N];
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				const auto f = (pos[i][j] - bmin[j]) * (cells / (bmax[j] - bmin[j]));
+				q[j] = static_cast<K>(std::min(std::max(f, 0.0f), std::nextafter(cells, 0.0f)));
+			}
+			if constexpr (N == 2)
+				TEST_ASSERT(morton[i] == sek::morton_encode(q[0], q[1]) && hilbert[i] == sek::hilbert_encode(q[0], q[1]));
+			else
+				TEST_ASSERT(morton[i] == sek::morton_encode(q[0], q[1], q[2]) && hilbert[i] == sek::hilbert_encode(q[0], q[1], q[2]));
+		}
+		TEST_ASSERT(morton[0] == 0 && hilbert[0] == 0);
+	};
+	test_batch.operator()<std::uint32_t, 2>();
+	test_batch.operator()<std::uint64_t, 2>();
+	test_batch.operator()<std::uint32_t, 3>();
+	test_batch.operator()<std::uint64_t, 3>();
+}
+
+inline void test_lbvh() noexcept
+{
+	auto g = sek::xoroshiro<float, 128>{0x1b5};
+	const auto random_box = [&](float extent)
+	{
+		const auto c = sek::vec3<float>{g(), g(), g()} * 100.0f;
+		const auto s = sek::vec3<float>{g(), g(), g()} * extent;
+		return sek::bbox<float>{c - s, c + s};
+	};
+	const auto overlaps = [](const sek::bbox<float> &a, const sek::bbox<float> &b)
+	{
+		return sek::all_of(a.min() <= b.max()) && sek::all_of(a.max() >= b.min());
+	};
+
+	/* Large enough to sort & build in parallel. Duplicate boxes produce equal Morton keys. */
+	std::vector<sek::bbox<float>> boxes(40000);
+	for (auto &b: boxes) b = random_box(1.0f);
+	for (std::size_t i = 0; i < 64; ++i) boxes[i + 64] = boxes[i];
+	auto lbvh = sek::lbvh<float>{boxes};
+	TEST_ASSERT(lbvh.size() == boxes.size());
+
+	const auto check_queries = [&]()
+	{
+		std::vector<std::uint32_t> result;
+		lbvh.query_overlap(lbvh.bounds(), [&](std::uint32_t j) { result.push_back(j); });
+		TEST_ASSERT(result.size() == boxes.size());
+
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			const auto q = random_box(10.0f);
+			std::vector<std::uint32_t> expected;
+			result.clear();
+			for (std::uint32_t j = 0; j < boxes.size(); ++j)
+				if (overlaps(boxes[j], q)) expected.push_back(j);
+			lbvh.query_overlap(q, [&](std::uint32_t j) { result.push_back(j); });
+			std::ranges::sort(result);
+			TEST_ASSERT(result == expected);
+
+			const auto p = q.center();
+			expected.clear();
+			result.clear();
+			for (std::uint32_t j = 0; j < boxes.size(); ++j)
+				if (sek::all_of(boxes[j].min() <= p) && sek::all_of(boxes[j].max() >= p)) expected.push_back(j);
+			lbvh.query_point(p, [&](std::uint32_t j) { result.push_back(j); });
+			std::ranges::sort(result);
+			TEST_ASSERT(result == expected);
+		}
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			const auto r = sek::ray3<float>{{-10.0f, g() * 100.0f, g() * 100.0f}, sek::normalize(sek::vec3<float>{1.0f, g() - 0.5f, g() - 0.5f})};
+
+			auto best = std::numeric_limits<float>::infinity();
+			for (const auto &b: boxes)
+				if (const auto hit = sek::intersect(r, b); hit.hit()) best = std::min(best, hit.tnear);
+
+			const auto hit = lbvh.nearest_hit(r);
+			TEST_ASSERT(hit.has_value() == (best != std::numeric_limits<float>::infinity()));
+			if (hit.has_value()) TEST_ASSERT(hit->distance == best && sek::intersect(r, boxes[hit->index]).tnear == best);
+		}
+	};
+	check_queries();
+
+	for (auto &b: boxes) b = sek::bbox<float>{b.min() + 5.0f, b.max() + 5.0f};
+	lbvh.refit(boxes);
+	check_queries();
+
+	/* Degenerate sizes & user indices. */
+	const std::vector<std::uint32_t> indices = {10, 20};
+	const std::vector<sek::bbox<float>> small = {{{0, 0, 0}, {1, 1, 1}}, {{2, 0, 0}, {3, 1, 1}}};
+	auto small_lbvh = sek::lbvh<float>{std::span{small}.first(1), std::span{indices}.first(1)};
+	std::vector<std::uint32_t> result;
+	small_lbvh.query_point(sek::vec3<float>{0.5f}, [&](std::uint32_t j) { result.push_back(j); });
+	TEST_ASSERT((result == std::vector<std::uint32_t>{10}));
+	small_lbvh.build(small, indices);
+	result.clear();
+	small_lbvh.query_point(sek::vec3<float>{2.5f, 0.5f, 0.5f}, [&](std::uint32_t j) { result.push_back(j); });
+	TEST_ASSERT((result == std::vector<std::uint32_t>{20}));
+	TEST_ASSERT(small_lbvh.nearest_hit(sek::ray3<float>{{-1, 0.5f, 0.5f}, {1, 0, 0}})->index == 10);
+
+	small_lbvh.build({});
+	TEST_ASSERT(small_lbvh.empty() && !small_lbvh.nearest_hit(sek::ray3<float>{{-1, 0.5f, 0.5f}, {1, 0, 0}}).has_value());
+}
+
+inline void test_expr() noexcept
+{
+	using vec_t = sek::vec3<float>;
+
+	auto g = sek::xoroshiro<float, 128>{0xe4b};
+	std::vector<vec_t> a(37), b(37), c(37), out(37), expected(37);
+	std::vector<float> w(37);
+	for (std::size_t i = 0; i < a.size(); ++i)
+	{
+		a[i] = vec_t{g(), g(), g()} * 2.0f - 1.0f;
+		b[i] = vec_t{g(), g(), g()} * 2.0f - 1.0f;
+		c[i] = vec_t{g(), g(), g()} + 0.5f;
+		w[i] = g();
+	}
+	const auto &ca = a;
+
+	const auto check = [&]()
+	{
+		for (std::size_t i = 0; i < out.size(); ++i)
+			if (!sek::all_of(out[i] == expected[i])) return false;
+		return true;
+	};
+
+	sek::lazy(out) = sek::lazy(ca) * 3.0f + sek::lazy(b) - sek::lazy(c);
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = a[i] * 3.0f + b[i] - c[i];
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = sek::fmadd(sek::lazy(a), 0.5f, sek::lazy(b)) / sek::lazy(c);
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = sek::fmadd(a[i], vec_t{0.5f}, b[i]) / c[i];
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = sek::lerp(sek::lazy(a), sek::lazy(b), sek::lazy(w)) + vec_t{1.0f, 2.0f, 3.0f};
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = sek::lerp(a[i], b[i], vec_t{w[i]}) + vec_t{1.0f, 2.0f, 3.0f};
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = sek::max(sek::min(sek::lazy(a), sek::lazy(b)), -0.5f) * -sek::lazy(c);
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = sek::max(sek::min(a[i], b[i]), vec_t{-0.5f}) * -c[i];
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = sek::atan2(sek::sin(sek::lazy(a)), sek::cos(sek::lazy(b))) - sek::abs(sek::lazy(a) * sek::lazy(w));
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = sek::atan2(sek::sin(a[i]), sek::cos(b[i])) - sek::abs(a[i] * w[i]);
+	TEST_ASSERT(check());
+
+	/* Compound assignment reads & writes the same elements. */
+	sek::lazy(out) += sek::lazy(a) * 2.0f;
+	for (std::size_t i = 0; i < a.size(); ++i) expected[i] = expected[i] + a[i] * 2.0f;
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = vec_t{4.0f};
+	std::ranges::fill(expected, vec_t{4.0f});
+	TEST_ASSERT(check());
+
+	sek::lazy(out) = sek::lazy(b);
+	expected = b;
+	TEST_ASSERT(check());
+	sek::lazy(std::span{out}.first(4)) = sek::lazy(std::span{a}.first(4));
+	std::copy_n(a.begin(), 4, expected.begin());
+	TEST_ASSERT(check());
+
+	/* Scalar ranges. */
+	std::vector<float> ws(w.size());
+	sek::lazy(ws) = sek::lazy(w) * 2.0f + 1.0f;
+	for (std::size_t i = 0; i < w.size(); ++i) TEST_ASSERT(ws[i] == w[i] * 2.0f + 1.0f);
+}
+
+inline void test_constexpr() noexcept
+{
+	using vec3_t = sek::packed_vec3<float>;
+	using mat4_t = sek::packed_mat4x4<float>;
+	using quat_t = sek::packed_quat<float>;
+
+	constexpr auto a = vec3_t{1.0f, 2.0f, 3.0f};
+	constexpr auto b = vec3_t{-2.0f, 0.5f, 4.0f};
+	static_assert(sek::dot(a, b) == 11.0f);
+	static_assert(sek::all_of(sek::cross(a, b) == vec3_t{6.5f, -10.0f, 4.5f}));
+	static_assert(sek::magn(vec3_t{3.0f, 4.0f, 0.0f}) == 5.0f);
+	static_assert(sek::hmax(sek::max(a, b)) == 4.0f);
+
+	constexpr auto angles = vec3_t{0.3f, -0.7f, 1.1f};
+	constexpr auto n = sek::normalize(b);
+	constexpr auto s = sek::sin(vec3_t{0.3f, -2.5f, 100.0f});
+	constexpr auto m = sek::rotate(sek::scale(mat4_t::identity(), vec3_t{2.0f, 3.0f, 4.0f}), 0.5f, n);
+	constexpr auto mi = sek::inverse(m);
+	constexpr auto la = mat4_t::look_at(a, b);
+	constexpr auto q = quat_t::from_euler(angles);
+	constexpr auto qm = mat4_t{q};
+	constexpr auto qv = q * a;
+	constexpr auto qa = quat_t::angle_axis(0.5f, n);
+	constexpr auto qr = quat_t{qm};
+
+	/* Constant-evaluated results must match their run-time counterparts. */
+	auto ra = a, rb = b, rangles = angles;
+	const auto rn = sek::normalize(rb);
+	const auto rm = sek::rotate(sek::scale(mat4_t::identity(), vec3_t{2.0f, 3.0f, 4.0f}), 0.5f, rn);
+	const auto rq = quat_t::from_euler(rangles);
+	TEST_ASSERT(sek::fcmp_eq(n, rn, 1e-6f));
+	TEST_ASSERT((sek::fcmp_eq(s, vec3_t{std::sin(0.3f), std::sin(-2.5f), std::sin(100.0f)}, 1e-5f)));
+	TEST_ASSERT(sek::fcmp_eq(m, rm, 1e-6f));
+	TEST_ASSERT(sek::fcmp_eq(mi, sek::inverse(rm), 1e-5f));
+	TEST_ASSERT(sek::fcmp_eq(la, mat4_t::look_at(ra, rb), 1e-6f));
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(q, rq, 1e-6f)));
+	TEST_ASSERT(sek::fcmp_eq(qm, mat4_t{rq}, 1e-6f));
+	TEST_ASSERT(sek::fcmp_eq(qv, rq * ra, 1e-5f));
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(qa, quat_t::angle_axis(0.5f, rn), 1e-6f)));
+	TEST_ASSERT(sek::all_of(sek::fcmp_eq(qr, q, 1e-5f)));
+}
+
 int main()
 {
 	TEST_ASSERT((sek::mat4x4<float>::identity() == sek::mat4x4<float>{sek::mat3x3<float>::identity(), sek::vec3<float>{0}}));
@@ -92,4 +1299,28 @@ int main()
 	test_translate();
 	test_rotate();
 	test_scale();
+	test_soa();
+	test_transform_batch();
+	test_multiply_batch();
+	test_inverse_batch();
+	test_affine();
+	test_slerp_batch();
+	test_dual_quat();
+	test_xoroshiro_simd();
+	test_xoroshiro_discard();
+	test_xoroshiro_generate();
+	test_sampling();
+	test_entropy_pool();
+	test_xoroshiro_registry();
+	test_philox();
+	test_serialize();
+	test_bvh();
+	test_lbvh();
+	test_frustum();
+	test_ray();
+	test_transform_bounds();
+	test_spatial_grid();
+	test_spatial_keys();
+	test_expr();
+	test_constexpr();
 }
\ No newline at end of file